@@ -28,10 +28,12 @@
 #define CRYPTO_H
 
 #include <crypto_common.h>
-#include <encoding/address_encoding.h>
 #include <encoding/base58.h>
+#ifndef CRYPTO_VERIFICATION_ONLY
+#include <encoding/address_encoding.h>
 #include <encoding/cn_base58.h>
 #include <encoding/mnemonics.h>
+#endif
 #include <proofs/audit.h>
 #include <proofs/bulletproofs.h>
 #include <proofs/bulletproofsplus.h>
@@ -42,10 +44,12 @@
 #include <signatures/ring_signature_clsag.h>
 #include <signatures/ring_signature_triptych.h>
 #include <signatures/signature.h>
-#include <types/crypto_entropy_t.h>
 #include <types/crypto_hash_vector_t.h>
-#include <types/crypto_hd_key_t.h>
 #include <types/crypto_secret_key_t.h>
+#ifndef CRYPTO_VERIFICATION_ONLY
+#include <types/crypto_entropy_t.h>
+#include <types/crypto_hd_key_t.h>
 #include <types/crypto_seed_t.h>
+#endif
 
 #endif // CRYPTO_H
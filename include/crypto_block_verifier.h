@@ -0,0 +1,149 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef CRYPTO_BLOCK_VERIFIER_H
+#define CRYPTO_BLOCK_VERIFIER_H
+
+#include <proofs/bulletproofs.h>
+#include <proofs/bulletproofsplus.h>
+#include <proofs/merkle.h>
+#include <signatures/ring_signature_borromean.h>
+#include <signatures/ring_signature_clsag.h>
+#include <signatures/ring_signature_triptych.h>
+
+namespace Crypto
+{
+    /**
+     * Collects every proof and signature workload of a block and verifies them
+     * together: each scheme's workload folds into its batch verifier and the
+     * batches are scheduled onto the shared worker pool heaviest first so all
+     * cores stay busy through the whole validation window, while the merkle
+     * root is computed on the submitting thread. The result is one verdict
+     * covering everything plus the computed root
+     */
+    struct block_verifier_t
+    {
+        /**
+         * Queues a Borromean ring signature for verification
+         * @param message_digest
+         * @param key_image
+         * @param public_keys
+         * @param signature
+         */
+        void add_borromean(
+            const crypto_hash_t &message_digest,
+            const crypto_key_image_t &key_image,
+            const std::vector<crypto_public_key_t> &public_keys,
+            const crypto_borromean_signature_t &signature);
+
+        /**
+         * Queues a Bulletproof range proof for verification
+         * @param proof
+         * @param commitments
+         */
+        void add_bulletproof(
+            const crypto_bulletproof_t &proof,
+            const std::vector<crypto_pedersen_commitment_t> &commitments);
+
+        /**
+         * Queues a Bulletproof+ range proof for verification
+         * @param proof
+         * @param commitments
+         */
+        void add_bulletproof_plus(
+            const crypto_bulletproof_plus_t &proof,
+            const std::vector<crypto_pedersen_commitment_t> &commitments);
+
+        /**
+         * Queues a CLSAG ring signature for verification
+         * @param message_digest
+         * @param key_image
+         * @param public_keys
+         * @param signature
+         * @param commitments
+         */
+        void add_clsag(
+            const crypto_hash_t &message_digest,
+            const crypto_key_image_t &key_image,
+            const std::vector<crypto_public_key_t> &public_keys,
+            const crypto_clsag_signature_t &signature,
+            const std::vector<crypto_pedersen_commitment_t> &commitments = {});
+
+        /**
+         * Queues a Triptych ring signature for verification
+         * @param message_digest
+         * @param key_image
+         * @param public_keys
+         * @param signature
+         * @param commitments
+         */
+        void add_triptych(
+            const crypto_hash_t &message_digest,
+            const crypto_key_image_t &key_image,
+            const std::vector<crypto_public_key_t> &public_keys,
+            const crypto_triptych_signature_t &signature,
+            const std::vector<crypto_pedersen_commitment_t> &commitments);
+
+        /**
+         * Supplies the block's transaction hashes for the merkle root
+         * @param hashes
+         */
+        void set_merkle_leaves(const std::vector<crypto_hash_t> &hashes);
+
+        /**
+         * Verifies everything queued and returns the combined verdict along
+         * with the merkle root of the supplied leaves; the queued workloads
+         * are cleared regardless of the outcome
+         * @param N the range proof bit size
+         * @return {verdict, merkle_root}
+         */
+        [[nodiscard]] std::tuple<bool, crypto_hash_t> verify(size_t N = 64);
+
+      private:
+        std::vector<crypto_hash_t> borromean_messages, clsag_messages, triptych_messages;
+
+        std::vector<crypto_key_image_t> borromean_key_images, clsag_key_images, triptych_key_images;
+
+        std::vector<std::vector<crypto_public_key_t>> borromean_rings, clsag_rings, triptych_rings;
+
+        std::vector<crypto_borromean_signature_t> borromean_signatures;
+
+        std::vector<crypto_clsag_signature_t> clsag_signatures;
+
+        std::vector<std::vector<crypto_pedersen_commitment_t>> clsag_commitments, triptych_commitments,
+            bulletproof_commitments, bulletproof_plus_commitments;
+
+        std::vector<crypto_triptych_signature_t> triptych_signatures;
+
+        std::vector<crypto_bulletproof_t> bulletproofs;
+
+        std::vector<crypto_bulletproof_plus_t> bulletproofs_plus;
+
+        std::vector<crypto_hash_t> merkle_leaves;
+    };
+} // namespace Crypto
+
+#endif // CRYPTO_BLOCK_VERIFIER_H
@@ -34,6 +34,161 @@ namespace Crypto
 {
     namespace AES
     {
+        /**
+         * A reusable keyslot whereby the password KDF runs exactly once at
+         * construction and the resulting key then encrypts and decrypts any
+         * number of payloads; this is the bulk path for callers that handle
+         * many records under a single passphrase (a wallet unlock, a backup
+         * restore) where re-running the KDF per record dominates
+         *
+         * Keyslot payloads carry a fresh random IV per encryption and rely on
+         * the caller to retain the slot salt (see salt()) for re-derivation
+         */
+        struct keyslot_t
+        {
+            /**
+             * Derives a keyslot from the supplied password using a random salt
+             *
+             * @param password
+             * @param iterations
+             */
+            explicit keyslot_t(const std::string &password, size_t iterations = CRYPTO_PBKDF2_ITERATIONS);
+
+            /**
+             * Derives a keyslot from the supplied password and salt
+             *
+             * @param password
+             * @param salt
+             * @param iterations
+             */
+            keyslot_t(
+                const std::string &password,
+                const std::vector<uint8_t> &salt,
+                size_t iterations = CRYPTO_PBKDF2_ITERATIONS);
+
+            ~keyslot_t();
+
+            /**
+             * Decrypts a payload previously produced by encrypt() on a keyslot
+             * derived with the same password and salt
+             *
+             * @param input
+             * @return
+             */
+            [[nodiscard]] std::vector<uint8_t> decrypt(const std::vector<uint8_t> &input) const;
+
+            /**
+             * Encrypts the provided data with the keyslot key under a fresh
+             * random IV
+             *
+             * @param input
+             * @return
+             */
+            [[nodiscard]] std::vector<uint8_t> encrypt(const std::vector<uint8_t> &input) const;
+
+            /**
+             * Returns the salt the keyslot key was derived with
+             *
+             * @return
+             */
+            [[nodiscard]] const std::vector<uint8_t> &salt() const;
+
+          private:
+            friend struct stream_encryptor_t;
+
+            friend struct stream_decryptor_t;
+
+            std::vector<uint8_t> slot_salt;
+
+            unsigned char key[16] = {0};
+        };
+
+        struct stream_encryptor_t;
+
+        struct stream_decryptor_t;
+
+        /**
+         * Streaming encryption over a keyslot for payloads too large to hold
+         * in memory: construct against a keyslot, emit the 16-byte iv() at the
+         * head of the output stream, feed the plaintext through update() in
+         * chunks of any size, and append the output of finalize() at the end.
+         * The resulting stream is exactly what keyslot_t::encrypt() would have
+         * produced for the whole buffer
+         */
+        struct stream_encryptor_t
+        {
+            explicit stream_encryptor_t(const keyslot_t &keyslot);
+
+            ~stream_encryptor_t();
+
+            stream_encryptor_t(const stream_encryptor_t &) = delete;
+
+            stream_encryptor_t &operator=(const stream_encryptor_t &) = delete;
+
+            /**
+             * Finishes the stream and returns the final ciphertext bytes
+             * @return
+             */
+            [[nodiscard]] std::vector<uint8_t> finalize();
+
+            /**
+             * Returns the random IV for this stream (written at the stream head)
+             * @return
+             */
+            [[nodiscard]] const std::vector<uint8_t> &iv() const;
+
+            /**
+             * Encrypts the next chunk of plaintext returning whatever
+             * ciphertext is ready so far
+             * @param data
+             * @param length
+             * @return
+             */
+            [[nodiscard]] std::vector<uint8_t> update(const void *data, size_t length);
+
+          private:
+            std::vector<uint8_t> stream_iv;
+
+            // opaque handle to the underlying transformation filter
+            void *filter = nullptr;
+        };
+
+        /**
+         * Streaming decryption counterpart: construct against the keyslot and
+         * the 16-byte IV from the stream head, feed the ciphertext through
+         * update() in chunks, and take the final plaintext from finalize()
+         */
+        struct stream_decryptor_t
+        {
+            stream_decryptor_t(const keyslot_t &keyslot, const unsigned char iv[16]);
+
+            ~stream_decryptor_t();
+
+            stream_decryptor_t(const stream_decryptor_t &) = delete;
+
+            stream_decryptor_t &operator=(const stream_decryptor_t &) = delete;
+
+            /**
+             * Finishes the stream, verifying the padding, and returns the
+             * final plaintext bytes
+             * @return
+             */
+            [[nodiscard]] std::vector<uint8_t> finalize();
+
+            /**
+             * Decrypts the next chunk of ciphertext returning whatever
+             * plaintext is ready so far
+             * @param data
+             * @param length
+             * @return
+             */
+            [[nodiscard]] std::vector<uint8_t> update(const void *data, size_t length);
+
+          private:
+            // opaque handle to the underlying transformation filter
+            void *filter = nullptr;
+        };
+
         /**
          * Decrypts data from the provided hexadecimal encoded encrypted string using the supplied password
          *
@@ -47,6 +202,20 @@ namespace Crypto
             const std::string &password,
             size_t iterations = CRYPTO_PBKDF2_ITERATIONS);
 
+        /**
+         * Decrypts binary data encrypted with the supplied password without any
+         * hexadecimal round-trip
+         *
+         * @param input
+         * @param password
+         * @param iterations
+         * @return
+         */
+        std::vector<uint8_t> decrypt(
+            const std::vector<uint8_t> &input,
+            const std::string &password,
+            size_t iterations = CRYPTO_PBKDF2_ITERATIONS);
+
         /**
          * Encrypts the provided string using the supplied password into a hexadecimal encoded encrypted string
          *
@@ -59,6 +228,20 @@ namespace Crypto
             const std::string &input,
             const std::string &password,
             size_t iterations = CRYPTO_PBKDF2_ITERATIONS);
+
+        /**
+         * Encrypts the provided binary data using the supplied password without
+         * any hexadecimal round-trip
+         *
+         * @param input
+         * @param password
+         * @param iterations
+         * @return
+         */
+        std::vector<uint8_t> encrypt(
+            const std::vector<uint8_t> &input,
+            const std::string &password,
+            size_t iterations = CRYPTO_PBKDF2_ITERATIONS);
     } // namespace AES
 
     /**
@@ -88,6 +271,64 @@ namespace Crypto
         return crypto_scalar_t::check(value);
     }
 
+    /**
+     * Returns whether the given 32-byte encoding is one of the interned
+     * constant points (the library generators plus anything added via
+     * register_constant_point); registered constants are known-good so
+     * validation against them short-circuits
+     * @param data
+     * @return
+     */
+    bool is_registered_constant_point(const void *data);
+
+    /**
+     * Interns the given point as a known-good constant so later validation of
+     * its encoding short-circuits (the generator vectors register themselves
+     * when preloaded); the point is subgroup-checked at registration and
+     * anything outside the prime-order subgroup is refused with an exception
+     * @param point
+     */
+    void register_constant_point(const crypto_point_t &point);
+
+    /**
+     * Checks in a single pass that the given value is a valid point on the
+     * curve AND free of torsion (a member of the prime-order subgroup); the
+     * value is decompressed exactly once and the subgroup test rides the
+     * precomputed-multiple path instead of paying separate validity and
+     * cofactor multiplication passes
+     * @param value
+     * @return
+     */
+    template<typename T> bool check_point_full(const T &value)
+    {
+        try
+        {
+            const auto point = crypto_point_t(value);
+
+            // interned constants are known-good; skip the subgroup work
+            if (is_registered_constant_point(point.data()))
+            {
+                return true;
+            }
+
+            return point.check_subgroup();
+        }
+        catch (const std::exception &e)
+        {
+            PRINTF(e.what())
+
+            return false;
+        }
+    }
+
+    /**
+     * Checks that every point in the vector is valid and torsion-free (see
+     * check_point_full); large sets are checked across the shared worker pool
+     * @param values
+     * @return
+     */
+    bool check_points_full(const std::vector<crypto_point_t> &values);
+
     /**
      * Checks for point torsion
      * @param value
@@ -106,7 +347,8 @@ namespace Crypto
     crypto_point_t commitment_tensor_point(const crypto_point_t &point, size_t i, size_t j, size_t k = 0);
 
     /**
-     * Calculates a convolution of a degree-one polynomial
+     * Calculates the convolution (polynomial product) of the two coefficient
+     * vectors, dispatching large products into Karatsuba splitting by size
      * @param x
      * @param y
      * @return
@@ -122,6 +364,51 @@ namespace Crypto
      */
     crypto_scalar_t derivation_to_scalar(const crypto_derivation_t &derivation, uint64_t output_index = 0);
 
+    /**
+     * Generates the derivation scalars for an entire range of output indexes
+     * against a single derivation, reusing one transcript buffer across the
+     * whole batch; this is the wallet-scanning fast path whereby every chain
+     * output is checked against an account's derivation
+     * Ds[i] = H(D || output_indexes[i]) mod l
+     * @param derivation
+     * @param output_indexes
+     * @return
+     */
+    std::vector<crypto_scalar_t>
+        derivation_to_scalar(const crypto_derivation_t &derivation, const std::vector<uint64_t> &output_indexes);
+
+    /**
+     * A reusable derivation session: the transcript prefix (the derivation
+     * domain and the derivation itself, which is shared by every output of a
+     * transaction) is absorbed into the hash state exactly once at
+     * construction, and each output index clones that compact state and
+     * appends only its index bytes. This removes the prefix re-hash that
+     * dominates repeated derivation-to-scalar calls while producing exactly
+     * the same scalars as the one-shot entry points
+     */
+    struct derivation_session_t
+    {
+        explicit derivation_session_t(const crypto_derivation_t &derivation);
+
+        ~derivation_session_t();
+
+        derivation_session_t(const derivation_session_t &) = delete;
+
+        derivation_session_t &operator=(const derivation_session_t &) = delete;
+
+        /**
+         * Returns the derivation scalar for the given output index
+         * Ds = H(D || output_index) mod l
+         * @param output_index
+         * @return
+         */
+        [[nodiscard]] crypto_scalar_t scalar(uint64_t output_index) const;
+
+      private:
+        // opaque handle to the absorbed hash state
+        void *state = nullptr;
+    };
+
     /**
      * Calculates the public ephemeral given the derivation and the destination public key
      * P = [(Ds * G) + B] mod l
@@ -169,6 +456,27 @@ namespace Crypto
      */
     crypto_key_image_t generate_key_image_v2(const crypto_scalar_t &secret_ephemeral);
 
+    /**
+     * Generates the key images for a whole set of ephemeral pairs whereby the
+     * per-output hash-to-point and scalar multiplication work is spread across
+     * the shared worker pool
+     * @param public_ephemerals
+     * @param secret_ephemerals
+     * @return
+     */
+    std::vector<crypto_key_image_t> generate_key_images(
+        const std::vector<crypto_public_key_t> &public_ephemerals,
+        const std::vector<crypto_scalar_t> &secret_ephemerals);
+
+    /**
+     * Generates the v2 key images for a whole set of secret ephemerals whereby
+     * all of the scalar inversions collapse into a single simultaneous
+     * inversion and each multiplication rides the precomputed U table
+     * @param secret_ephemerals
+     * @return
+     */
+    std::vector<crypto_key_image_t> generate_key_images_v2(const std::vector<crypto_scalar_t> &secret_ephemerals);
+
     /**
      * Generates a set of random keys
      * a = random_scalar()
@@ -230,6 +538,21 @@ namespace Crypto
         const crypto_derivation_t &derivation,
         uint64_t output_index,
         const crypto_public_key_t &public_ephemeral);
+
+    /**
+     * Much like underive_public_key() but recovers the public keys for an
+     * entire range of output indexes and public ephemerals against a single
+     * derivation with the derivation scalars generated as one batch
+     * B[i] = P[i] - [H(D || output_indexes[i]) mod l]
+     * @param derivation
+     * @param output_indexes
+     * @param public_ephemerals
+     * @return
+     */
+    std::vector<crypto_public_key_t> underive_public_keys(
+        const crypto_derivation_t &derivation,
+        const std::vector<uint64_t> &output_indexes,
+        const std::vector<crypto_public_key_t> &public_ephemerals);
 } // namespace Crypto
 
 #endif // CRYPTO_COMMON_H
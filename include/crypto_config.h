@@ -47,6 +47,10 @@
 #define CRYPTO_ENTROPY_BYTES 32
 #endif
 
+#ifndef CRYPTO_RANDOM_BYTES_POOL_SIZE
+#define CRYPTO_RANDOM_BYTES_POOL_SIZE 4096
+#endif
+
 #ifndef BENCHMARK_PERFORMANCE_ITERATIONS
 #define BENCHMARK_PERFORMANCE_ITERATIONS 1000
 #endif
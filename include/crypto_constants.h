@@ -30,6 +30,18 @@
 #include <types/crypto_hash_t.h>
 #include <types/crypto_scalar_t.h>
 
+/**
+ * If the generate_constants tool has been run then the domain constants below
+ * (and the leading range-proof generator vectors) are baked into a generated
+ * header and nothing needs to be derived at process startup; otherwise we fall
+ * back to deriving them at runtime exactly as before
+ */
+#if defined(__has_include)
+#if __has_include(<crypto_constants_generated.h>)
+#define CRYPTO_USE_GENERATED_CONSTANTS
+#endif
+#endif
+
 const auto SALT_DOMAIN = crypto_scalar_t("202053504f4e534f52454420425920444f4e5554532041524520474f4f442020");
 
 /**
@@ -62,6 +74,12 @@ static inline crypto_point_t generate_salt_point(size_t index)
  * TLDR: these are hash salts
  */
 
+#ifdef CRYPTO_USE_GENERATED_CONSTANTS
+
+#include <crypto_constants_generated.h>
+
+#else
+
 const auto DERIVATION_DOMAIN_0 = generate_salt_scalar(0);
 
 const auto SPEND_KEY_DOMAIN_0 = generate_salt_scalar(1);
@@ -102,4 +120,6 @@ const auto OUTPUT_PROOF_DOMAIN = generate_salt_scalar(18);
 
 const auto TRANSCRIPT_BASE = generate_salt_scalar(19);
 
+#endif // CRYPTO_USE_GENERATED_CONSTANTS
+
 #endif
@@ -0,0 +1,68 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef CRYPTO_INIT_H
+#define CRYPTO_INIT_H
+
+#include <cstddef>
+
+namespace Crypto
+{
+    /**
+     * Controls what Crypto::init() front-loads
+     */
+    struct init_options_t
+    {
+        // the number of Gi/Hi generator pairs to build per range proof scheme
+        size_t generator_count = 256;
+
+        // build the independent pieces across the shared worker pool
+        bool parallel = true;
+
+        // construct the mnemonic wordlists (skip for verifier-only processes)
+        bool include_wordlists = true;
+    };
+
+    /**
+     * Front-loads every lazily-built piece of library state -- the fixed-base
+     * generator tables, the range proof generator vectors, and (optionally)
+     * the mnemonic wordlists -- so the first real operation after process
+     * start does not stall building them; the domain constants themselves are
+     * derived during static initialization (or baked at build time) and need
+     * no warming. Safe to call more than once
+     * @param options
+     */
+    void init(const init_options_t &options = {});
+
+    /**
+     * Front-loads only the state verification touches (the fixed-base tables
+     * and the range proof generator vectors) for verifier-only processes
+     * @param generator_count
+     */
+    void preload_verification_tables(size_t generator_count = 256);
+} // namespace Crypto
+
+#endif // CRYPTO_INIT_H
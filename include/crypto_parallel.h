@@ -0,0 +1,168 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef CRYPTO_PARALLEL_H
+#define CRYPTO_PARALLEL_H
+
+#include <algorithm>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+/**
+ * A single library-wide worker pool that every parallel entry point dispatches
+ * into instead of spinning up its own threads. The pool is created lazily on
+ * first use; workers claim loop indexes dynamically from a shared cursor so
+ * uneven work items balance across the pool automatically. Nested calls from
+ * inside a pool worker degrade gracefully to running inline on the caller
+ */
+namespace Crypto::Parallel
+{
+    /**
+     * Returns the number of threads (including the calling thread) that
+     * parallel work is spread across
+     * @return
+     */
+    size_t concurrency();
+
+    /**
+     * Sets the number of threads that parallel work is spread across whereby
+     * zero (0) selects the hardware concurrency; takes effect the next time
+     * the pool is (re)created and is intended to be called once at startup
+     * @param threads
+     */
+    void set_concurrency(size_t threads);
+
+    /**
+     * Runs body(i) for every i in [begin, end) across the shared pool with the
+     * calling thread participating; returns once every index has completed
+     * @param begin
+     * @param end
+     * @param body
+     */
+    void parallel_for(size_t begin, size_t end, const std::function<void(size_t)> &body);
+
+    /**
+     * Runs the two independent tasks concurrently, the first on the pool and
+     * the second on the calling thread, returning when both have completed
+     * @param first
+     * @param second
+     */
+    void parallel_invoke(const std::function<void()> &first, const std::function<void()> &second);
+
+    /**
+     * Enqueues the task for execution by a pool worker; used by async() below
+     * @param task
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * Runs the callable asynchronously on the shared worker pool returning a
+     * future for its result; inputs should be captured by value so the caller
+     * can continue without keeping them alive
+     * @tparam F
+     * @param callable
+     * @return
+     */
+    template<typename F> auto async(F &&callable) -> std::future<decltype(callable())>
+    {
+        typedef decltype(callable()) result_t;
+
+        auto task = std::make_shared<std::packaged_task<result_t()>>(std::forward<F>(callable));
+
+        auto future = task->get_future();
+
+        submit([task]() { (*task)(); });
+
+        return future;
+    }
+
+    /**
+     * Computes the reduction of body(i) over [begin, end) whereby each thread
+     * folds a contiguous chunk into a partial with combine() and the partials
+     * are folded together on the calling thread
+     * @tparam T
+     * @tparam Combine
+     * @param begin
+     * @param end
+     * @param identity
+     * @param body
+     * @param combine
+     * @return
+     */
+    template<typename T, typename Combine>
+    T parallel_reduce(
+        size_t begin,
+        size_t end,
+        const T &identity,
+        const std::function<T(size_t)> &body,
+        const Combine &combine)
+    {
+        if (end <= begin)
+        {
+            return identity;
+        }
+
+        const auto count = end - begin;
+
+        const auto chunks = std::min(concurrency(), count);
+
+        const auto chunk_size = (count + chunks - 1) / chunks;
+
+        std::vector<T> partials(chunks, identity);
+
+        parallel_for(
+            0,
+            chunks,
+            [&](size_t chunk)
+            {
+                const auto chunk_begin = begin + (chunk * chunk_size);
+
+                const auto chunk_end = std::min(chunk_begin + chunk_size, end);
+
+                auto partial = identity;
+
+                for (size_t i = chunk_begin; i < chunk_end; ++i)
+                {
+                    partial = combine(partial, body(i));
+                }
+
+                partials[chunk] = partial;
+            });
+
+        auto result = identity;
+
+        for (const auto &partial : partials)
+        {
+            result = combine(result, partial);
+        }
+
+        return result;
+    }
+} // namespace Crypto::Parallel
+
+#endif // CRYPTO_PARALLEL_H
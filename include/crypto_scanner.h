@@ -0,0 +1,87 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef CRYPTO_SCANNER_H
+#define CRYPTO_SCANNER_H
+
+#include <crypto_common.h>
+
+/**
+ * The owned-output scanning engine: feed it a wallet's keys and a flat run of
+ * chain output records and it returns the records the wallet owns. Internally
+ * the key derivation is computed once per transaction key (records are
+ * scanned in order, so outputs of one transaction share their derivation),
+ * the derivation scalars reuse one transcript buffer, and the record stream
+ * is partitioned contiguously across the shared worker pool
+ */
+namespace Crypto::Scanner
+{
+    /**
+     * One chain output as presented to the scanner
+     */
+    struct output_record_t
+    {
+        // the transaction public key (R) the output was created against
+        crypto_public_key_t tx_public_key;
+
+        // the output public ephemeral (P)
+        crypto_public_key_t output_key;
+
+        // the index of the output within its transaction
+        uint64_t output_index = 0;
+    };
+
+    /**
+     * One owned output discovered by the scanner
+     */
+    struct match_t
+    {
+        // the index of the matching record in the scanned input
+        size_t record_index = 0;
+
+        // the derivation scalar for the output (feeds spend key derivation)
+        crypto_scalar_t derivation_scalar;
+    };
+
+    /**
+     * Scans the records for outputs owned by the wallet whereby for each
+     * record the scanner computes
+     *   D = (a * R) mod l
+     *   Ds = H(D || output_index) mod l
+     * and reports a match when [P - (Ds * G)] equals the wallet's public
+     * spend key; matches are returned in record order
+     * @param public_spend_key the wallet's public spend key (B)
+     * @param private_view_key the wallet's private view key (a)
+     * @param records
+     * @return
+     */
+    std::vector<match_t> scan(
+        const crypto_public_key_t &public_spend_key,
+        const crypto_scalar_t &private_view_key,
+        const std::vector<output_record_t> &records);
+} // namespace Crypto::Scanner
+
+#endif // CRYPTO_SCANNER_H
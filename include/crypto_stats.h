@@ -0,0 +1,155 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef CRYPTO_STATS_H
+#define CRYPTO_STATS_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+/**
+ * Opt-in per-operation performance counters. When ENABLE_CRYPTO_STATS is
+ * defined at build time (-DENABLE_STATS=1 via CMake) the primitive operations
+ * bump plain per-thread counters -- a single thread-local increment, cheap
+ * enough to leave enabled on canary nodes -- and the per-thread totals are
+ * readable and resettable through the snapshot APIs below. Without the flag
+ * the instrumentation macro compiles away entirely
+ */
+namespace Crypto::Stats
+{
+    struct counters_t
+    {
+        // full variable-base or fixed-base scalar multiplications
+        uint64_t scalar_mults = 0;
+
+        // fused double scalar multiplications
+        uint64_t double_scalar_mults = 0;
+
+        // point additions (including those inside the multiexp engines)
+        uint64_t point_additions = 0;
+
+        // point decompressions (deserialize/load of a point)
+        uint64_t point_decompressions = 0;
+
+        // sha3 message hashes
+        uint64_t sha3_hashes = 0;
+
+        // range proof prove/verify entry point invocations
+        uint64_t range_proof_operations = 0;
+
+        // ring signature check entry point invocations
+        uint64_t ring_signature_checks = 0;
+    };
+
+    /**
+     * Returns a copy of the calling thread's counters
+     * @return
+     */
+    counters_t snapshot();
+
+    /**
+     * Resets the calling thread's counters to zero
+     */
+    void reset();
+
+#ifdef ENABLE_CRYPTO_STATS
+    /**
+     * Returns the calling thread's live counters for instrumentation sites
+     * @return
+     */
+    counters_t &thread_counters();
+#endif
+
+    typedef std::function<void(const char *operation, uint64_t nanoseconds)> timing_callback_t;
+
+    /**
+     * Registers a callback invoked with the name and wall time of every
+     * instrumented prove/verify entry point (range proofs, the ring signature
+     * checks, and audit verification); pass an empty function to unregister.
+     * While no callback is registered the instrumented paths check one flag
+     * and never touch the clock
+     * @param callback
+     */
+    void set_timing_callback(timing_callback_t callback);
+
+    /**
+     * Returns whether a timing callback is currently registered
+     * @return
+     */
+    bool timing_enabled();
+
+    /**
+     * Delivers one timing observation to the registered callback
+     * @param operation
+     * @param nanoseconds
+     */
+    void report_timing(const char *operation, uint64_t nanoseconds);
+
+    /**
+     * Scope timer used by the instrumented entry points: it reads the clock
+     * only when a callback is registered and reports on destruction
+     */
+    struct operation_timer_t
+    {
+        explicit operation_timer_t(const char *operation): operation(operation)
+        {
+            if (timing_enabled())
+            {
+                started = std::chrono::steady_clock::now();
+
+                armed = true;
+            }
+        }
+
+        ~operation_timer_t()
+        {
+            if (armed)
+            {
+                report_timing(
+                    operation,
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started)
+                        .count());
+            }
+        }
+
+        const char *operation;
+
+        std::chrono::steady_clock::time_point started;
+
+        bool armed = false;
+    };
+} // namespace Crypto::Stats
+
+#define CRYPTO_TIME_OPERATION(name) const Crypto::Stats::operation_timer_t operation_timer(name);
+
+#ifdef ENABLE_CRYPTO_STATS
+#define CRYPTO_STATS_COUNT(field) Crypto::Stats::thread_counters().field++;
+#else
+#define CRYPTO_STATS_COUNT(field)
+#endif
+
+#endif // CRYPTO_STATS_H
@@ -65,6 +65,29 @@ namespace Crypto::Address
             const uint64_t &prefix,
             const crypto_public_key_t &public_spend,
             const crypto_public_key_t &public_view);
+
+        /**
+         * Decodes a whole set of Base58 addresses in one call, fanning large
+         * sets across the shared worker pool
+         *
+         * @param addresses
+         * @return
+         */
+        std::vector<std::tuple<bool, uint64_t, crypto_public_key_t, crypto_public_key_t>>
+            decode(const std::vector<std::string> &addresses);
+
+        /**
+         * Encodes a whole set of public key pairs with the given prefix in one
+         * call whereby the serialization and checksum hashing state is reused
+         * per worker and large sets fan out across the shared worker pool
+         *
+         * @param prefix
+         * @param key_pairs {public_spend, public_view} pairs
+         * @return
+         */
+        std::vector<std::string> encode(
+            const uint64_t &prefix,
+            const std::vector<std::tuple<crypto_public_key_t, crypto_public_key_t>> &key_pairs);
     } // namespace Base58
 
     /**
@@ -57,6 +57,17 @@ namespace Crypto::Base58
      */
     [[nodiscard]] std::string encode(std::vector<uint8_t> input);
 
+    /**
+     * Encodes the raw bytes into a Base58 encoded string reading directly from
+     * the caller's buffer (a serializer's storage, an mmap window) without any
+     * staging copy
+     *
+     * @param data
+     * @param length
+     * @return
+     */
+    [[nodiscard]] std::string encode(const uint8_t *data, size_t length);
+
     /**
      * Encodes the contents of the reader into a Base58 encoded string
      *
@@ -82,6 +93,16 @@ namespace Crypto::Base58
      */
     [[nodiscard]] std::string encode_check(const std::vector<uint8_t> &input);
 
+    /**
+     * Encodes the raw bytes (read directly from the caller's buffer) into a
+     * Base58 encoded string with the standard checksum appended
+     *
+     * @param data
+     * @param length
+     * @return
+     */
+    [[nodiscard]] std::string encode_check(const uint8_t *data, size_t length);
+
     /**
      * Encodes contents of the reader into a Base58 encoded string including a checksum that
      * allows for ensuring that the raw bytes included inside were not altered
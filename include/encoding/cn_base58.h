@@ -59,6 +59,16 @@ namespace Crypto::CNBase58
      */
     [[nodiscard]] std::string encode(const std::vector<uint8_t> &input);
 
+    /**
+     * Encodes the raw bytes into a CryptoNote Base58 encoded string reading
+     * directly from the caller's buffer without any staging copy
+     *
+     * @param data
+     * @param length
+     * @return
+     */
+    [[nodiscard]] std::string encode(const uint8_t *data, size_t length);
+
     /**
      * Encodes the contents of the reader into a Base58 encoded string
      *
@@ -54,7 +54,7 @@ namespace Crypto::Mnemonics::Language
      * @param language
      * @return
      */
-    std::vector<std::string> select_word_list(const Language &language);
+    const std::vector<std::string> &select_word_list(const Language &language);
 
     /**
      * Returns the minimum word length for the specified language
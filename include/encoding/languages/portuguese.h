@@ -32,7 +32,7 @@
 
 namespace Crypto::Mnemonics::Language::Portuguese
 {
-    std::vector<std::string> word_list();
+    const std::vector<std::string> &word_list();
 }
 
 #endif
@@ -28,6 +28,7 @@
 #define CRYPTO_MNEMONICS_H
 
 #include <encoding/languages/language.h>
+#include <string_view>
 #include <types/crypto_entropy_t.h>
 
 namespace Crypto::Mnemonics
@@ -74,6 +75,22 @@ namespace Crypto::Mnemonics
     std::vector<std::string>
         encode(const crypto_entropy_t &wallet_seed, const Language::Language &language = Language::Language::ENGLISH);
 
+    /**
+     * Encodes a whole batch of entropy blocks into mnemonics in one call: the
+     * word indexes are computed directly from the bits (no per-word string
+     * conversion), the checksum hashing state is reused per worker, large
+     * batches fan out across the shared worker pool, and the returned views
+     * point straight into the language's static word list so no word text is
+     * copied
+     *
+     * @param entropy
+     * @param language
+     * @return
+     */
+    std::vector<std::vector<std::string_view>> encode_batch(
+        const std::vector<crypto_entropy_t> &entropy,
+        const Language::Language &language = Language::Language::ENGLISH);
+
     /**
      * Returns the supported languages
      *
@@ -81,6 +98,32 @@ namespace Crypto::Mnemonics
      */
     std::vector<Language::Language> languages();
 
+    /**
+     * Returns every word in the language's word list beginning with the given
+     * prefix; the per-language prefix index is built once on first use
+     *
+     * @param prefix
+     * @param language
+     * @return
+     */
+    std::vector<std::string> complete_word_prefix(
+        const std::string &prefix,
+        const Language::Language &language = Language::Language::ENGLISH);
+
+    /**
+     * Resolves a (possibly partial) word to its word list index when the
+     * prefix identifies exactly one word -- an exact full-word match always
+     * wins even when it prefixes longer words -- enabling the standard
+     * 4-character-prefix import behavior
+     *
+     * @param prefix
+     * @param language
+     * @return {success, index}
+     */
+    std::tuple<bool, size_t> resolve_word_prefix(
+        const std::string &prefix,
+        const Language::Language &language = Language::Language::ENGLISH);
+
     /**
      * Finds the index of the given word in the word list or returns -1 if not found
      *
@@ -104,7 +147,7 @@ namespace Crypto::Mnemonics
      * @param language
      * @return
      */
-    std::vector<std::string> word_list_trimmed(const Language::Language &language = Language::Language::ENGLISH);
+    const std::vector<std::string> &word_list_trimmed(const Language::Language &language = Language::Language::ENGLISH);
 } // namespace Crypto::Mnemonics
 
 #endif
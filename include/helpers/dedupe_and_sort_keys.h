@@ -27,10 +27,119 @@
 #ifndef CRYPTO_DEDUPE_AND_SORT_KEYS_H
 #define CRYPTO_DEDUPE_AND_SORT_KEYS_H
 
+#include <algorithm>
 #include <cstring>
-#include <set>
 #include <vector>
 
+/**
+ * Sorts the range [lo, hi) of fixed-width keys in descending byte order using
+ * an in-place most-significant-byte radix sort; small ranges fall back to an
+ * insertion sort over the remaining undecided bytes
+ * @tparam T
+ * @param keys the keys to sort
+ * @param lo
+ * @param hi
+ * @param byte_index the byte position this pass partitions on
+ */
+template<typename T> void radix_sort_keys(std::vector<T> &keys, size_t lo, size_t hi, size_t byte_index)
+{
+    const auto key_width = keys.empty() ? 0 : keys.front().size();
+
+    if (hi - lo < 2 || byte_index >= key_width)
+    {
+        return;
+    }
+
+    // small partitions sort faster by insertion over the remaining bytes
+    if (hi - lo <= 32)
+    {
+        const auto remaining = key_width - byte_index;
+
+        for (size_t i = lo + 1; i < hi; ++i)
+        {
+            for (size_t j = i;
+                 j > lo && std::memcmp(keys[j].data() + byte_index, keys[j - 1].data() + byte_index, remaining) > 0;
+                 --j)
+            {
+                std::swap(keys[j], keys[j - 1]);
+            }
+        }
+
+        return;
+    }
+
+    size_t counts[256] = {0};
+
+    for (size_t i = lo; i < hi; ++i)
+    {
+        counts[keys[i][byte_index]]++;
+    }
+
+    /**
+     * Buckets are laid out from 0xff down to 0x00 to preserve the descending
+     * ordering that the comparison-based implementation has always produced
+     */
+    size_t starts[256], ends[256], next[256];
+
+    size_t offset = lo;
+
+    for (size_t b = 256; b-- > 0;)
+    {
+        starts[b] = offset;
+
+        next[b] = offset;
+
+        offset += counts[b];
+
+        ends[b] = offset;
+    }
+
+    // permute every key into its bucket in place (one swap settles one key)
+    for (size_t b = 256; b-- > 0;)
+    {
+        for (size_t i = next[b]; i < ends[b];)
+        {
+            const auto digit = keys[i][byte_index];
+
+            if (digit == b)
+            {
+                ++i;
+            }
+            else
+            {
+                std::swap(keys[i], keys[next[digit]]);
+
+                next[digit]++;
+            }
+        }
+    }
+
+    for (size_t b = 0; b < 256; ++b)
+    {
+        radix_sort_keys(keys, starts[b], ends[b], byte_index + 1);
+    }
+}
+
+/**
+ * Removes duplicates from a vector of keys and sorts them by value in place
+ * using a most-significant-byte radix sort followed by a single dedupe sweep;
+ * this avoids both the per-comparison key walks and the node allocations of
+ * the tree-based implementation which matters for very large key-image sets
+ * @tparam T
+ * @param keys the keys to dedupe and sort
+ */
+template<typename T> void dedupe_and_sort_keys_in_place(std::vector<T> &keys)
+{
+    radix_sort_keys(keys, 0, keys.size(), 0);
+
+    keys.erase(
+        std::unique(
+            keys.begin(),
+            keys.end(),
+            [](const T &a, const T &b) { return std::memcmp(a.data(), b.data(), a.size()) == 0; }),
+        keys.end());
+}
+
 /**
  * Removes duplicates from a vector of keys and sorts them by value
  * @tparam T
@@ -39,11 +148,9 @@
  */
 template<typename T> std::vector<T> dedupe_and_sort_keys(const std::vector<T> &keys)
 {
-    auto cmp = [](const T a, const T b) { return std::memcmp(a.data(), b.data(), a.size()) > 0; };
-
-    std::set<T, decltype(cmp)> seen(keys.begin(), keys.end(), cmp);
+    auto result = keys;
 
-    std::vector<T> result(seen.begin(), seen.end());
+    dedupe_and_sort_keys_in_place(result);
 
     return result;
 }
@@ -0,0 +1,122 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef CRYPTO_FIXED_BASE_TABLE_T
+#define CRYPTO_FIXED_BASE_TABLE_T
+
+#include <types/crypto_scalar_t.h>
+
+/**
+ * A precomputed wide-window table for a fixed base point that turns a full
+ * scalar multiplication ladder into a handful of table lookups and point
+ * additions. The table stores, for each 4-bit window of the scalar, every
+ * non-zero multiple of the shifted base so that a multiplication is simply
+ * one addition per window with no doublings at all.
+ *
+ * Building a table costs roughly a thousand point additions so tables are
+ * only worth constructing for bases that are multiplied against repeatedly
+ * (the curve generators being the obvious candidates)
+ */
+struct fixed_base_table_t final
+{
+    /**
+     * Constructs the precomputed table for the given base point
+     * @param base
+     */
+    explicit fixed_base_table_t(const crypto_point_t &base);
+
+    /**
+     * Returns the base point that the table was constructed for
+     * @return
+     */
+    [[nodiscard]] crypto_point_t base() const;
+
+    /**
+     * Computes (a * this table's base) + (b * the other table's base) in one
+     * interleaved pass over both precomputed tables; this is the fast path for
+     * Pedersen-commitment-shaped operations over the fixed (H, G) pair where
+     * the amount side touches only a handful of windows
+     * @param a
+     * @param other
+     * @param b
+     * @return
+     */
+    [[nodiscard]] crypto_point_t
+        dbl_mult(const crypto_scalar_t &a, const fixed_base_table_t &other, const crypto_scalar_t &b) const;
+
+    /**
+     * Multiplies the fixed base by the given scalar using the precomputed table
+     * @param scalar
+     * @return
+     */
+    [[nodiscard]] crypto_point_t mul(const crypto_scalar_t &scalar) const;
+
+  private:
+    // one row per 4-bit window of the scalar, 15 non-zero digits per row
+    static const size_t WINDOWS = 64, DIGITS = 15;
+
+    crypto_point_t base_point;
+
+    std::vector<std::vector<crypto_point_t>> table;
+};
+
+namespace Crypto
+{
+    /**
+     * Returns the precomputed fixed-base table for the primary generator point G
+     * @return
+     */
+    const fixed_base_table_t &G_table();
+
+    /**
+     * Returns the precomputed fixed-base table for the secondary generator point H
+     * @return
+     */
+    const fixed_base_table_t &H_table();
+
+    /**
+     * Returns the precomputed fixed-base table for the generator point U
+     * @return
+     */
+    const fixed_base_table_t &U_table();
+
+    /**
+     * Returns the precomputed table for the pre-scaled base (1/8) * G; scalar
+     * multiplications against it produce the cofactor-cleared result directly
+     * so commitment-shaped operations never pay a separate INV_EIGHT multiply
+     * @return
+     */
+    const fixed_base_table_t &G_inv8_table();
+
+    /**
+     * Returns the precomputed table for the pre-scaled base (1/8) * H (see
+     * G_inv8_table)
+     * @return
+     */
+    const fixed_base_table_t &H_inv8_table();
+} // namespace Crypto
+
+#endif // CRYPTO_FIXED_BASE_TABLE_T
@@ -30,29 +30,52 @@
 #ifndef CRYPTO_GRAY_CODE_GENERATOR_T
 #define CRYPTO_GRAY_CODE_GENERATOR_T
 
+#include <array>
 #include <cstdint>
 #include <types/crypto_scalar_t.h>
 #include <vector>
 
+/**
+ * Lazily streams the (digit index, old value, new value) deltas of the N-ary
+ * Gray code over K digits; the sequence is generated one delta at a time from
+ * O(K) state rather than materializing the whole table up front, so the
+ * Triptych loops walk through the codes cache-resident
+ */
 struct gray_code_generator_t
 {
     gray_code_generator_t(size_t N, size_t K, size_t v = -1);
 
-    std::vector<int> operator[](int i) const;
+    /**
+     * Advances to the next delta in the sequence; returns false once the
+     * sequence is exhausted
+     * @return
+     */
+    bool advance();
 
-    [[nodiscard]] size_t size() const;
+    /**
+     * Returns the current {digit index, old value, new value} delta
+     * @return
+     */
+    [[nodiscard]] const std::array<int, 3> &current() const;
 
-    [[nodiscard]] std::vector<std::vector<int>> values() const;
+    /**
+     * Returns the total number of codes in the sequence (N ^ K)
+     * @return
+     */
+    [[nodiscard]] size_t size() const;
 
+    /**
+     * Returns the full digit decomposition at the index v supplied at
+     * construction
+     * @return
+     */
     [[nodiscard]] std::vector<int> v_value() const;
 
   private:
-    void generate();
-
-    std::vector<std::vector<int>> changed;
+    std::array<int, 3> changed = {0, 0, 0};
     std::vector<int> v_changed;
     std::vector<int> g, u;
-    size_t N = 0, K = 0, v = -1;
+    size_t N = 0, K = 0, v = -1, index = 0, count = 0;
 };
 
 #endif
@@ -52,6 +52,29 @@ std::vector<unsigned char>
 std::tuple<crypto_hash_t, crypto_hash_t>
     generate_hd_child_key(const crypto_hash_t &parent_key, const crypto_hash_t &chain_code, const std::string &path);
 
+/**
+ * Generates an HD child key given the parent key, chain code, and an already
+ * parsed path (the indices carry the hardened bit); bulk derivation should
+ * parse its path once and reuse the parsed form through this entry point
+ *
+ * @param parent_key
+ * @param chain_code
+ * @param parsed_path
+ * @return
+ */
+std::tuple<crypto_hash_t, crypto_hash_t> generate_hd_child_key(
+    const crypto_hash_t &parent_key,
+    const crypto_hash_t &chain_code,
+    const std::vector<uint32_t> &parsed_path);
+
+/**
+ * Parses a BIP-32 path string into its index form (hardened bit applied)
+ *
+ * @param path
+ * @return
+ */
+std::vector<uint32_t> parse_bip32_path(const std::string &path);
+
 /**
  * Constructs a hardened BIP32 path using the supplied parameters
  *
@@ -0,0 +1,176 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef CRYPTO_MULTIEXP_H
+#define CRYPTO_MULTIEXP_H
+
+#include <string>
+#include <types/crypto_hash_t.h>
+#include <types/crypto_point_t.h>
+#include <types/crypto_scalar_t.h>
+
+/**
+ * The minimum number of terms for which the bucketed (Pippenger) multiexp
+ * engine is faster than pairing terms off via double scalar multiplication;
+ * below this count the per-window bucket setup costs more than it saves
+ */
+#ifndef CRYPTO_MULTIEXP_THRESHOLD
+#define CRYPTO_MULTIEXP_THRESHOLD 32
+#endif
+
+/**
+ * A cache-aware table of fixed generator points: the ge_cached form of every
+ * point (the only representation the addition law in the multiexp engine
+ * touches) is stored as one contiguous plane, so walking thousands of
+ * generators streams dense cache lines instead of striding across the full
+ * crypto_point_t objects
+ */
+struct generator_table_t final
+{
+    generator_table_t() = default;
+
+    explicit generator_table_t(const std::vector<crypto_point_t> &points);
+
+    ~generator_table_t();
+
+    generator_table_t(const generator_table_t &) = delete;
+
+    generator_table_t &operator=(const generator_table_t &) = delete;
+
+    [[nodiscard]] const ge_cached *data() const
+    {
+        return view;
+    }
+
+    /**
+     * Maps the table file read-only (every process on the host shares the
+     * same physical pages) after validating the versioned header against the
+     * supplied derivation parameters hash and this build's element layout;
+     * on platforms without mappings the file is read into private memory
+     * @param path
+     * @param parameters_hash
+     * @return
+     */
+    bool load(const std::string &path, const crypto_hash_t &parameters_hash);
+
+    /**
+     * Materializes the table into the given file with a versioned header
+     * binding it to the supplied derivation parameters hash so stale or
+     * foreign tables are rejected at load
+     * @param path
+     * @param parameters_hash
+     * @return
+     */
+    bool save(const std::string &path, const crypto_hash_t &parameters_hash) const;
+
+    [[nodiscard]] size_t size() const
+    {
+        return count;
+    }
+
+  private:
+    void unmap();
+
+    // the active plane (owned storage or a read-only mapping)
+    const ge_cached *view = nullptr;
+
+    size_t count = 0;
+
+    std::vector<ge_cached> plane;
+
+    void *mapping = nullptr;
+
+    size_t mapping_length = 0;
+};
+
+namespace Crypto
+{
+    /**
+     * Computes the sum of scalars[i] * points[i] across the supplied vectors
+     * using the Pippenger (bucket) method whereby the scalars are split into
+     * windows of a few bits each and, window by window, each point is dropped
+     * into the bucket matching its digit. Each window then costs a linear pass
+     * of point additions instead of a full scalar multiplication per term which
+     * is what makes large batches (range proof verification in particular) so
+     * much cheaper than computing the terms individually.
+     *
+     * The window width is selected automatically from the number of terms
+     * supplied.
+     *
+     * @param scalars
+     * @param points
+     * @return
+     */
+    crypto_point_t
+        multiexp(const std::vector<crypto_scalar_t> &scalars, const std::vector<crypto_point_t> &points);
+
+    /**
+     * Computes the sum of scalars[i] * points[i] reading directly from the
+     * provided contiguous storage (see above); this form exists so that
+     * non-owning views can dispatch into the engine without copying
+     * @param scalars
+     * @param points
+     * @param count
+     * @return
+     */
+    crypto_point_t multiexp(const crypto_scalar_t *scalars, const crypto_point_t *points, size_t count);
+
+    /**
+     * Computes the sum of scalars[i] * points[i] for a small number of terms
+     * using Straus interleaving: per-term tables of small multiples share one
+     * run of doublings, so fusing n terms costs roughly a single scalar
+     * multiplication ladder instead of one ladder per pair of terms. This
+     * supersedes chaining dbl_mult calls wherever three or more terms are
+     * combined; large term counts dispatch into the bucketed engine instead
+     * @param scalars
+     * @param points
+     * @param count
+     * @return
+     */
+    crypto_point_t multi_mult(const crypto_scalar_t *scalars, const crypto_point_t *points, size_t count);
+
+    /**
+     * Computes the sum of scalars[i] * points[i] for a small number of terms
+     * (see above)
+     * @param scalars
+     * @param points
+     * @return
+     */
+    crypto_point_t
+        multi_mult(const std::vector<crypto_scalar_t> &scalars, const std::vector<crypto_point_t> &points);
+
+    /**
+     * Computes the sum of scalars[i] * table[i] over a contiguous generator
+     * table entirely in extended coordinates; this is the engine the range
+     * proof verifier tails use for their generator planes
+     * @param scalars
+     * @param table
+     * @return
+     */
+    crypto_point_t multiexp(const std::vector<crypto_scalar_t> &scalars, const generator_table_t &table);
+} // namespace Crypto
+
+#endif // CRYPTO_MULTIEXP_H
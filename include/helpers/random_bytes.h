@@ -28,6 +28,7 @@
 #ifndef CRYPTO_RANDOM_BYTES_H
 #define CRYPTO_RANDOM_BYTES_H
 
+#include <cstdint>
 #include <random>
 
 #ifdef __cplusplus
@@ -50,6 +51,23 @@ extern "C"
 
 #ifdef __cplusplus
 }
+
+/**
+ * Switches random_bytes() onto a deterministic generator seeded with the
+ * given value so that test and benchmark key material reproduces exactly
+ * between runs
+ *
+ * FOR TEST AND BENCHMARK USE ONLY: the deterministic stream is not secret
+ * and must never be selected in production processes
+ *
+ * @param seed
+ */
+void random_bytes_seed_deterministic(uint64_t seed);
+
+/**
+ * Returns random_bytes() to the operating system entropy source
+ */
+void random_bytes_use_system_entropy();
 #endif
 
 #endif // CRYPTO_RANDOM_BYTES_H
@@ -33,6 +33,13 @@
 /**
  * Structure provides a transcript for hashing arbitrary values in a determinisic way
  * that can be used for constructing challenge scalars during commitments
+ *
+ * The transcript is incremental by construction: each update absorbs the new
+ * values by hashing them together with the running state, so a transcript of
+ * k updates costs exactly k constant-size hashes and extracting a challenge
+ * is free. The chained-hash form is part of the proof transcripts of every
+ * existing signature and range proof, so it must not be exchanged for a raw
+ * sponge even though one would be marginally cheaper per update
  */
 struct scalar_transcript_t
 {
@@ -87,6 +94,18 @@ struct scalar_transcript_t
         return T(state.serialize());
     }
 
+    /**
+     * Writes the challenge scalar for the current transcript state directly
+     * into the caller's storage so challenge extraction on the proving hot
+     * path touches no temporaries
+     *
+     * @param out
+     */
+    void challenge_into(crypto_scalar_t &out) const
+    {
+        out = state;
+    }
+
     /**
      * Resets the transcript to its base state
      */
@@ -103,7 +122,7 @@ struct scalar_transcript_t
      */
     template<typename T> void update(const T &input)
     {
-        Serialization::serializer_t writer;
+        writer.reset();
 
         writer.pod(state);
 
@@ -122,7 +141,7 @@ struct scalar_transcript_t
      */
     template<typename T, typename U> void update(const T &input, const U &input2)
     {
-        Serialization::serializer_t writer;
+        writer.reset();
 
         writer.pod(state);
 
@@ -145,7 +164,7 @@ struct scalar_transcript_t
      */
     template<typename T, typename U, typename V> void update(const T &input, const U &input2, const V &input3)
     {
-        Serialization::serializer_t writer;
+        writer.reset();
 
         writer.pod(state);
 
@@ -173,7 +192,7 @@ struct scalar_transcript_t
     template<typename T, typename U, typename V, typename W>
     void update(const T &input, const U &input2, const V &input3, const W &input4)
     {
-        Serialization::serializer_t writer;
+        writer.reset();
 
         writer.pod(state);
 
@@ -188,6 +207,25 @@ struct scalar_transcript_t
         state = crypto_hash_t::sha3(writer.data(), writer.size()).scalar();
     }
 
+    /**
+     * Updates the transcript with a raw span of bytes without any
+     * intermediate value packing; the bytes are absorbed exactly as a pod of
+     * the same content would be
+     *
+     * @param input
+     * @param length
+     */
+    void update_bytes(const void *input, size_t length)
+    {
+        writer.reset();
+
+        writer.pod(state);
+
+        writer.bytes(static_cast<const unsigned char *>(input), length);
+
+        state = crypto_hash_t::sha3(writer.data(), writer.size()).scalar();
+    }
+
     /**
      * Updates the transcript with the vector of values provided
      *
@@ -196,7 +234,7 @@ struct scalar_transcript_t
      */
     template<typename T> void update(const std::vector<T> &input)
     {
-        Serialization::serializer_t writer;
+        writer.reset();
 
         writer.pod(state);
 
@@ -206,6 +244,9 @@ struct scalar_transcript_t
     }
 
   private:
+    // reused across updates so that absorbing values never re-allocates
+    Serialization::serializer_t writer;
+
     // default seed state for scalar transcripts
     crypto_scalar_t state = TRANSCRIPT_BASE;
 };
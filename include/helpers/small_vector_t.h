@@ -0,0 +1,150 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef CRYPTO_SMALL_VECTOR_T
+#define CRYPTO_SMALL_VECTOR_T
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+/**
+ * A vector with inline capacity for the first N elements so that ring-sized
+ * working sets (production rings are 16 members, the inline bound defaults to
+ * 32) live entirely on the stack; only when the element count exceeds the
+ * inline bound does the container spill to the heap. This is the storage used
+ * by the hot signing/verification scratch lists -- the serializable vector
+ * types themselves come from the serialization layer and keep their standard
+ * storage
+ */
+template<typename T, size_t N = 32> struct small_vector_t
+{
+    small_vector_t() = default;
+
+    explicit small_vector_t(size_t size, const T &value = T())
+    {
+        resize(size, value);
+    }
+
+    T &operator[](size_t i)
+    {
+        return data()[i];
+    }
+
+    const T &operator[](size_t i) const
+    {
+        return data()[i];
+    }
+
+    T &back()
+    {
+        return data()[count - 1];
+    }
+
+    [[nodiscard]] T *begin()
+    {
+        return data();
+    }
+
+    [[nodiscard]] const T *begin() const
+    {
+        return data();
+    }
+
+    [[nodiscard]] T *data()
+    {
+        return spilled() ? heap_storage.data() : inline_storage.data();
+    }
+
+    [[nodiscard]] const T *data() const
+    {
+        return spilled() ? heap_storage.data() : inline_storage.data();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return count == 0;
+    }
+
+    [[nodiscard]] T *end()
+    {
+        return data() + count;
+    }
+
+    [[nodiscard]] const T *end() const
+    {
+        return data() + count;
+    }
+
+    void push_back(const T &value)
+    {
+        resize(count + 1);
+
+        data()[count - 1] = value;
+    }
+
+    void resize(size_t size, const T &value = T())
+    {
+        if (size > N && !spilled())
+        {
+            // spill the inline elements to the heap exactly once
+            heap_storage.assign(inline_storage.begin(), inline_storage.begin() + count);
+        }
+
+        if (size > N || spilled())
+        {
+            heap_storage.resize(size, value);
+        }
+        else
+        {
+            for (size_t i = count; i < size; ++i)
+            {
+                inline_storage[i] = value;
+            }
+        }
+
+        count = size;
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+        return count;
+    }
+
+  private:
+    [[nodiscard]] bool spilled() const
+    {
+        return !heap_storage.empty() || count > N;
+    }
+
+    std::array<T, N> inline_storage {};
+
+    std::vector<T> heap_storage;
+
+    size_t count = 0;
+};
+
+#endif // CRYPTO_SMALL_VECTOR_T
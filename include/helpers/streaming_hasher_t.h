@@ -0,0 +1,105 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef CRYPTO_STREAMING_HASHER_T
+#define CRYPTO_STREAMING_HASHER_T
+
+#include <types/crypto_hash_t.h>
+
+/**
+ * Structure provides an incremental (init/update/final) hashing interface so
+ * that arbitrarily large inputs (bootstrap files, mmap windows, read loops)
+ * can be hashed in constant memory instead of being slurped into one buffer
+ * for the single-shot entry points on crypto_hash_t
+ */
+struct streaming_hasher_t final
+{
+    enum hash_algorithm_t
+    {
+        SHA3,
+        SHA256,
+        SHA384,
+        SHA512,
+        BLAKE2B
+    };
+
+    /**
+     * Initializes a streaming hasher for the given algorithm
+     * @param algorithm
+     */
+    explicit streaming_hasher_t(hash_algorithm_t algorithm = SHA3);
+
+    ~streaming_hasher_t();
+
+    // copying would alias the underlying hashing state so it is not permitted
+    streaming_hasher_t(const streaming_hasher_t &) = delete;
+
+    streaming_hasher_t &operator=(const streaming_hasher_t &) = delete;
+
+    /**
+     * Finalizes the hash over everything supplied to update() and resets the
+     * hasher so that it may be reused for another message
+     * @return
+     */
+    [[nodiscard]] crypto_hash_t finalize();
+
+    /**
+     * Finalizes the hash and then performs the same key-stretching rounds as
+     * crypto_hash_t::sha3_slow over the result whereby the result of finalize()
+     * for a complete buffer matches sha3() and this matches sha3_slow()
+     * @param iterations number of iterations
+     * @return
+     */
+    [[nodiscard]] crypto_hash_t finalize_slow(uint64_t iterations = 0);
+
+    /**
+     * Resets the hasher back to its initialized state
+     */
+    void reset();
+
+    /**
+     * Updates the hash with the bytes provided
+     * @param input
+     * @param length
+     */
+    void update(const void *input, size_t length);
+
+    /**
+     * Updates the hash with the value provided
+     * @tparam T
+     * @param input
+     */
+    template<typename T> void update(const T &input)
+    {
+        update(input.data(), input.size());
+    }
+
+  private:
+    // opaque handle to the underlying hashing context
+    void *context = nullptr;
+};
+
+#endif // CRYPTO_STREAMING_HASHER_T
@@ -0,0 +1,156 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef CRYPTO_WIRE_CODEC_H
+#define CRYPTO_WIRE_CODEC_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Primitives for the compact fixed-layout wire format exposed by the
+ * to_bytes()/from_bytes() methods on the proof and signature types: pod
+ * elements are written as their raw bytes back to back, vectors as a varint
+ * count followed by a contiguous element array, and readers walk a raw cursor
+ * with bounds checking so deserializing is a single pass over the input
+ */
+namespace WireCodec
+{
+    inline void write_varint(std::vector<uint8_t> &out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(uint8_t(value) | 0x80);
+
+            value >>= 7;
+        }
+
+        out.push_back(uint8_t(value));
+    }
+
+    inline uint64_t read_varint(const unsigned char *&cursor, const unsigned char *end)
+    {
+        uint64_t result = 0;
+
+        size_t shift = 0;
+
+        while (true)
+        {
+            if (cursor == end || shift >= 64)
+            {
+                throw std::invalid_argument("Could not read varint from wire data");
+            }
+
+            const auto byte = *cursor++;
+
+            result |= uint64_t(byte & 0x7f) << shift;
+
+            if ((byte & 0x80) == 0)
+            {
+                return result;
+            }
+
+            shift += 7;
+        }
+    }
+
+    /**
+     * Returns the number of bytes the given value occupies as a varint
+     * @param value
+     * @return
+     */
+    inline size_t varint_size(uint64_t value)
+    {
+        size_t result = 1;
+
+        while (value >= 0x80)
+        {
+            result++;
+
+            value >>= 7;
+        }
+
+        return result;
+    }
+
+    template<typename T> void write_pod(std::vector<uint8_t> &out, const T &pod)
+    {
+        out.insert(out.end(), pod.data(), pod.data() + pod.size());
+    }
+
+    template<typename T> T read_pod(const unsigned char *&cursor, const unsigned char *end)
+    {
+        const auto width = T().size();
+
+        if (size_t(end - cursor) < width)
+        {
+            throw std::invalid_argument("Could not read pod from wire data");
+        }
+
+        T result(std::vector<unsigned char>(cursor, cursor + width));
+
+        cursor += width;
+
+        return result;
+    }
+
+    template<typename T> void write_pod_vector(std::vector<uint8_t> &out, const std::vector<T> &pods)
+    {
+        write_varint(out, pods.size());
+
+        for (const auto &pod : pods)
+        {
+            write_pod(out, pod);
+        }
+    }
+
+    template<typename T> std::vector<T> read_pod_vector(const unsigned char *&cursor, const unsigned char *end)
+    {
+        const auto count = read_varint(cursor, end);
+
+        const auto width = T().size();
+
+        // dividing keeps the bound exact for hostile counts that would overflow a multiply
+        if (count > size_t(end - cursor) / width)
+        {
+            throw std::invalid_argument("Could not read pod vector from wire data");
+        }
+
+        std::vector<T> result;
+
+        result.reserve(count);
+
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            result.push_back(read_pod<T>(cursor, end));
+        }
+
+        return result;
+    }
+} // namespace WireCodec
+
+#endif // CRYPTO_WIRE_CODEC_H
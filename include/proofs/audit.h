@@ -44,16 +44,71 @@ namespace Crypto::Audit
     std::tuple<bool, std::vector<crypto_key_image_t>>
         check_outputs_proof(const std::vector<crypto_public_key_t> &public_ephemerals, const std::string &proof);
 
+    /**
+     * Verifies the proof as above but checks the extracted signatures across
+     * the shared worker pool. When early_exit is set the workers stop as soon
+     * as any signature fails; otherwise the entire set is always scanned. The
+     * third element of the result reports the index of the first failure
+     * observed (or SIZE_MAX when the proof verifies)
+     *
+     * @param public_ephemerals
+     * @param proof
+     * @param early_exit
+     * @return
+     */
+    std::tuple<bool, std::vector<crypto_key_image_t>, size_t> check_outputs_proof_parallel(
+        const std::vector<crypto_public_key_t> &public_ephemerals,
+        const std::string &proof,
+        bool early_exit = true);
+
+    /**
+     * Verifies an mmap-friendly proof archive produced by
+     * generate_outputs_proof_archive by streaming directly over the mapped
+     * bytes: records are read in place at their fixed stride and no key image
+     * or signature vectors are materialized, so archives larger than RAM
+     * verify in constant memory. Returns the verdict and, on failure, the
+     * index of the first failing record (SIZE_MAX when the archive verifies)
+     *
+     * @param public_ephemerals
+     * @param archive
+     * @param length
+     * @return {verdict, failing_index}
+     */
+    std::tuple<bool, size_t> check_outputs_proof_archive(
+        const std::vector<crypto_public_key_t> &public_ephemerals,
+        const unsigned char *archive,
+        size_t length);
+
+    /**
+     * Generates proof of having the secret ephemerals specified as an
+     * mmap-friendly archive: a fixed header (magic, version, record count)
+     * followed by fixed-stride records of key image, signature scalar, and
+     * challenge, so verifiers can map the file and stream it in place
+     *
+     * @param secret_ephemerals
+     * @return
+     */
+    std::tuple<bool, std::vector<uint8_t>>
+        generate_outputs_proof_archive(const std::vector<crypto_scalar_t> &secret_ephemerals);
+
     /**
      * Generates proof of having the secret ephemerals specified by generating the relevant
      * public keys, key images, and signature for each and encoding the necessary information
      * into a Base58 string that can be given to a verifier that already has the public
      * ephemerals
      *
+     * When more than one thread is requested the per-output key material and
+     * signatures are produced across the shared worker pool; the emitted proof
+     * preserves exactly the serial path's output ordering
+     *
      * @param secret_ephemerals
+     * @param threads the number of worker threads whereby zero (0) selects the
+     * hardware concurrency and one (1) keeps all of the work on the calling
+     * thread
      * @return
      */
-    std::tuple<bool, std::string> generate_outputs_proof(const std::vector<crypto_scalar_t> &secret_ephemerals);
+    std::tuple<bool, std::string>
+        generate_outputs_proof(const std::vector<crypto_scalar_t> &secret_ephemerals, size_t threads = 1);
 } // namespace Crypto::Audit
 
 #endif
@@ -34,18 +34,56 @@
 
 namespace Crypto::RangeProofs::Bulletproofs
 {
+    /**
+     * Builds (or extends) the cached Gi/Hi generator vectors up through the
+     * given count so that the first prove/verify after startup does not pay
+     * for deriving them
+     * @param count
+     */
+    void preload_generators(size_t count);
+
     /**
      * Generates a Bulletproof range proof and the related pedersen commitments
      * for the given amounts and blinding factors
      * @param amounts
      * @param blinding_factors
      * @param N the number of bits (2^n) to prove
+     * @param threads the number of worker threads to split the independent
+     * halves of each inner-product fold across whereby zero (0) selects the
+     * hardware concurrency and one (1) keeps all of the work on the calling
+     * thread
      * @return {proof, commitments}
      */
     std::tuple<crypto_bulletproof_t, std::vector<crypto_pedersen_commitment_t>> prove(
         const std::vector<uint64_t> &amounts,
         const std::vector<crypto_blinding_factor_t> &blinding_factors,
-        size_t N = 64);
+        size_t N = 64,
+        size_t threads = 1);
+
+    /**
+     * Compile-time fixed-N form of prove() for deployments that only ever use
+     * a single bit length: the bit size is validated as a power of two at
+     * compile time so the runtime range checks and rounding disappear from the
+     * instantiation. The working vectors remain dynamically sized as their
+     * storage is the shared serializable vector types
+     * @tparam BITS the number of bits (2^n) to prove
+     * @param amounts
+     * @param blinding_factors
+     * @param threads
+     * @return {proof, commitments}
+     */
+    template<size_t BITS = 64>
+    std::tuple<crypto_bulletproof_t, std::vector<crypto_pedersen_commitment_t>> prove(
+        const std::vector<uint64_t> &amounts,
+        const std::vector<crypto_blinding_factor_t> &blinding_factors,
+        size_t threads = 1)
+    {
+        static_assert(
+            BITS >= 1 && BITS <= 64 && (BITS & (BITS - 1)) == 0,
+            "the proof bit length must be a power of two between 1 and 64");
+
+        return prove(amounts, blinding_factors, BITS, threads);
+    }
 
     /**
      * Performs batch verification of the range proofs provided for the provided
@@ -30,35 +30,145 @@
 #ifndef CRYPTO_RANGEPROOFS_BULLETPROOFS_PLUS_H
 #define CRYPTO_RANGEPROOFS_BULLETPROOFS_PLUS_H
 
+#include <crypto_parallel.h>
 #include <types/crypto_bulletproof_plus_t.h>
 
 namespace Crypto::RangeProofs::BulletproofsPlus
 {
+    /**
+     * Accumulates range proofs as they arrive (a mempool stream) and defers
+     * the expensive point work until flush(), which folds everything queued
+     * into one fused weighted multiexp exactly like the up-front batch
+     * verifier; cheap structural validation happens at add() time so
+     * malformed proofs are rejected immediately without waiting for a flush
+     */
+    struct verifier_t
+    {
+        explicit verifier_t(size_t N = 64);
+
+        /**
+         * Queues the proof for the next flush after validating its structure;
+         * returns false (and does not queue) if the proof is malformed or its
+         * bit size does not match the accumulator
+         * @param proof
+         * @param commitments
+         * @return
+         */
+        bool add(const crypto_bulletproof_plus_t &proof, const std::vector<crypto_pedersen_commitment_t> &commitments);
+
+        /**
+         * Returns true when nothing is queued
+         * @return
+         */
+        [[nodiscard]] bool empty() const;
+
+        /**
+         * Verifies everything queued as a single fused batch, clears the
+         * queue, and returns the batch result
+         * @param threads
+         * @return
+         */
+        bool flush(size_t threads = 1);
+
+        /**
+         * Returns the number of proofs queued
+         * @return
+         */
+        [[nodiscard]] size_t size() const;
+
+      private:
+        std::vector<crypto_bulletproof_plus_t> proofs;
+
+        std::vector<std::vector<crypto_pedersen_commitment_t>> commitment_sets;
+
+        size_t bits = 64;
+    };
+
+    /**
+     * Builds (or extends) the cached Gi/Hi generator vectors up through the
+     * given count so that the first prove/verify after startup does not pay
+     * for deriving them
+     * @param count
+     */
+    void preload_generators(size_t count);
+
     /**
      * Generates a Bulletproof+ range proof and the related pedersen commitments
      * for the given amounts and blinding factors
      * @param amounts
      * @param blinding_factors
      * @param N
+     * @param threads the number of worker threads to split the independent
+     * halves of each inner-product fold across whereby zero (0) selects the
+     * hardware concurrency and one (1) keeps all of the work on the calling
+     * thread
      * @return
      */
     std::tuple<crypto_bulletproof_plus_t, std::vector<crypto_pedersen_commitment_t>> prove(
+        const std::vector<uint64_t> &amounts,
+        const std::vector<crypto_blinding_factor_t> &blinding_factors,
+        size_t N = 64,
+        size_t threads = 1);
+
+    /**
+     * Generates a Bulletproof+ range proof asynchronously on the shared worker
+     * pool, returning a future for the result; the inputs are captured by
+     * value so the caller may release them immediately
+     * @param amounts
+     * @param blinding_factors
+     * @param N
+     * @return
+     */
+    std::future<std::tuple<crypto_bulletproof_plus_t, std::vector<crypto_pedersen_commitment_t>>> prove_async(
         const std::vector<uint64_t> &amounts,
         const std::vector<crypto_blinding_factor_t> &blinding_factors,
         size_t N = 64);
 
+    /**
+     * Compile-time fixed-N form of prove() for deployments that only ever use
+     * a single bit length: the bit size is validated as a power of two at
+     * compile time so the runtime range checks and rounding disappear from the
+     * instantiation. The working vectors remain dynamically sized as their
+     * storage is the shared serializable vector types
+     * @tparam BITS the number of bits (2^n) to prove
+     * @param amounts
+     * @param blinding_factors
+     * @param threads
+     * @return {proof, commitments}
+     */
+    template<size_t BITS = 64>
+    std::tuple<crypto_bulletproof_plus_t, std::vector<crypto_pedersen_commitment_t>> prove(
+        const std::vector<uint64_t> &amounts,
+        const std::vector<crypto_blinding_factor_t> &blinding_factors,
+        size_t threads = 1)
+    {
+        static_assert(
+            BITS >= 1 && BITS <= 64 && (BITS & (BITS - 1)) == 0,
+            "the proof bit length must be a power of two between 1 and 64");
+
+        return prove(amounts, blinding_factors, BITS, threads);
+    }
+
     /**
      * Performs batch verification of the range proofs provided for the provided
      * pedersen commitments to the given values
+     *
+     * If more than one thread is requested then the batch is partitioned into
+     * per-thread chunks that are each folded into their own multiexp on a
+     * worker thread and the chunk results are combined
      * @param proofs
      * @param commitments
      * @param N
+     * @param threads the number of worker threads to partition the batch across
+     * whereby zero (0) selects the hardware concurrency and one (1) keeps all
+     * of the work on the calling thread
      * @return
      */
     bool verify(
         const std::vector<crypto_bulletproof_plus_t> &proofs,
         const std::vector<std::vector<crypto_pedersen_commitment_t>> &commitments,
-        size_t N = 64);
+        size_t N = 64,
+        size_t threads = 1);
 
     /**
      * Performs verification of the range proof provided for the provided
@@ -72,6 +182,38 @@ namespace Crypto::RangeProofs::BulletproofsPlus
         const crypto_bulletproof_plus_t &proof,
         const std::vector<crypto_pedersen_commitment_t> &commitments,
         size_t N = 64);
+
+    /**
+     * Generates a Bulletproof+ range proof for an output count that is not a
+     * power of two by padding the aggregate internally with zero-amount
+     * commitments under the fixed unit blinding factor; only the commitments
+     * for the real outputs are returned since the padding commitment is a
+     * known constant that verify_padded() re-derives at table-lookup cost
+     * @param amounts
+     * @param blinding_factors
+     * @param N
+     * @param threads
+     * @return
+     */
+    std::tuple<crypto_bulletproof_plus_t, std::vector<crypto_pedersen_commitment_t>> prove_padded(
+        const std::vector<uint64_t> &amounts,
+        const std::vector<crypto_blinding_factor_t> &blinding_factors,
+        size_t N = 64,
+        size_t threads = 1);
+
+    /**
+     * Verifies a proof produced by prove_padded() given only the commitments
+     * of the real outputs; the padded slots are filled with the known
+     * constant padding commitment before verification
+     * @param proof
+     * @param commitments
+     * @param N
+     * @return
+     */
+    bool verify_padded(
+        const crypto_bulletproof_plus_t &proof,
+        const std::vector<crypto_pedersen_commitment_t> &commitments,
+        size_t N = 64);
 } // namespace Crypto::RangeProofs::BulletproofsPlus
 
 
@@ -33,10 +33,18 @@ namespace Crypto::Merkle
 {
     /**
      * Generates the merkle root hash for the given set of hashes
+     *
+     * When more than one thread is requested and the leaf set is large, each
+     * tree level is computed across the shared worker pool with the top
+     * levels finishing serially; the result is identical to the
+     * single-threaded reduction
      * @param hashes
+     * @param threads the number of worker threads whereby zero (0) selects the
+     * hardware concurrency and one (1) keeps all of the work on the calling
+     * thread
      * @return
      */
-    crypto_hash_t root_hash(const std::vector<crypto_hash_t> &hashes);
+    crypto_hash_t root_hash(const std::vector<crypto_hash_t> &hashes, size_t threads = 1);
 
     /**
      * Generates the merkle root hash from the given set of merkle branches and the supplied leaf
@@ -59,6 +67,19 @@ namespace Crypto::Merkle
      */
     std::vector<crypto_hash_t> tree_branch(const std::vector<crypto_hash_t> &hashes);
 
+    /**
+     * Generates the merkle tree branches (sibling chains) for every requested
+     * leaf in a single tree traversal; requires a power-of-two leaf count as
+     * the per-leaf branches have a fixed depth. The branch for a given leaf
+     * folds back to the root with root_hash_from_branch using the leaf index
+     * bits as the per-level path
+     * @param hashes
+     * @param leaf_indexes
+     * @return
+     */
+    std::vector<std::vector<crypto_hash_t>>
+        tree_branches(const std::vector<crypto_hash_t> &hashes, const std::vector<size_t> &leaf_indexes);
+
     /**
      * Calculates the depth of the merkle tree based on the count of elements
      * @param count
@@ -67,5 +88,70 @@ namespace Crypto::Merkle
     size_t tree_depth(size_t count);
 } // namespace Crypto::Merkle
 
+/**
+ * An append-only merkle tree that caches every completed subtree (the peaks)
+ * so that appending a leaf and obtaining the updated root costs O(log n)
+ * hashing instead of rebuilding the whole tree from the leaf vector.
+ *
+ * Nodes are combined with exactly the same pair hash that
+ * Crypto::Merkle::root_hash_from_branch folds, so for power-of-two leaf
+ * counts the proofs extracted via branch() verify against root() with that
+ * method just like the output of tree_branch()
+ */
+struct incremental_merkle_tree_t final
+{
+    incremental_merkle_tree_t() = default;
+
+    /**
+     * Constructs the tree by appending each of the given leaves in order
+     * @param leaves
+     */
+    explicit incremental_merkle_tree_t(const std::vector<crypto_hash_t> &leaves);
+
+    /**
+     * Appends a leaf to the tree updating only the peaks along the right edge
+     * @param leaf
+     */
+    void append(const crypto_hash_t &leaf);
+
+    /**
+     * Extracts the branch (sibling chain) proving the first leaf, compatible
+     * with Crypto::Merkle::root_hash_from_branch with a path of zero (0);
+     * requires a power-of-two leaf count as branches have a fixed depth
+     * @return
+     */
+    [[nodiscard]] std::vector<crypto_hash_t> branch() const;
+
+    /**
+     * Returns the depth of the tree
+     * @return
+     */
+    [[nodiscard]] size_t depth() const;
+
+    /**
+     * Returns the current root of the tree by bagging the cached peaks
+     * @return
+     */
+    [[nodiscard]] crypto_hash_t root() const;
+
+    /**
+     * Returns the number of leaves in the tree
+     * @return
+     */
+    [[nodiscard]] size_t size() const;
+
+  private:
+    /**
+     * Combines two child nodes into their parent node
+     * @param left
+     * @param right
+     * @return
+     */
+    static crypto_hash_t combine(const crypto_hash_t &left, const crypto_hash_t &right);
+
+    // levels[0] holds the leaves, levels[k] the completed nodes at height k
+    std::vector<std::vector<crypto_hash_t>> levels;
+};
+
 
 #endif // CRYPTO_MERKLE_H
@@ -31,6 +31,80 @@
 
 namespace Crypto::RFC8032
 {
+    /**
+     * A reusable signing context: the public key is derived from the secret
+     * key exactly once at construction so continuous signing with one key
+     * skips the per-call basepoint multiplication
+     */
+    struct signer_context_t
+    {
+        explicit signer_context_t(const crypto_scalar_t &secret_key);
+
+        /**
+         * Returns the cached public key of the signer
+         * @return
+         */
+        [[nodiscard]] const crypto_public_key_t &public_key() const;
+
+        /**
+         * Generates a signature over the message with the cached key material
+         * @param message
+         * @param message_length
+         * @return
+         */
+        [[nodiscard]] crypto_signature_t sign(const void *message, size_t message_length) const;
+
+        /**
+         * Generates a signature over the value with the cached key material
+         * @tparam T
+         * @param message
+         * @return
+         */
+        template<typename T> [[nodiscard]] crypto_signature_t sign(const T &message) const
+        {
+            return sign(message.data(), message.size());
+        }
+
+      private:
+        crypto_scalar_t secret_key;
+
+        crypto_public_key_t signer_public_key;
+    };
+
+    /**
+     * A reusable verification context for repeated verification against one
+     * signer: the public key is decompressed once at construction and its
+     * extended/cached representations stay resident for every verify
+     */
+    struct verifier_context_t
+    {
+        explicit verifier_context_t(const crypto_public_key_t &public_key);
+
+        /**
+         * Checks the signature over the message against the cached signer key
+         * @param message
+         * @param message_length
+         * @param signature
+         * @return
+         */
+        [[nodiscard]] bool verify(const void *message, size_t message_length, const crypto_signature_t &signature) const;
+
+        /**
+         * Checks the signature over the value against the cached signer key
+         * @tparam T
+         * @param message
+         * @param signature
+         * @return
+         */
+        template<typename T> [[nodiscard]] bool verify(const T &message, const crypto_signature_t &signature) const
+        {
+            return verify(message.data(), message.size(), signature);
+        }
+
+      private:
+        crypto_public_key_t signer_public_key;
+    };
+
     /**
      * Checks that the supplied signature was generated with the private key for the given public key
      * @param message
@@ -59,6 +133,21 @@ namespace Crypto::RFC8032
         return check_signature(message.data(), message.size(), public_key, signature);
     }
 
+    /**
+     * Checks a batch of signatures using the standard batch verification
+     * equation whereby every signature is folded, under a random weight, into
+     * one combined multiexp; the batch only verifies if every individual
+     * signature would verify and an empty batch is vacuously valid
+     * @param messages
+     * @param public_keys
+     * @param signatures
+     * @return
+     */
+    bool verify_batch(
+        const std::vector<std::vector<unsigned char>> &messages,
+        const std::vector<crypto_public_key_t> &public_keys,
+        const std::vector<crypto_signature_t> &signatures);
+
     /**
      * Generates a single ED25519 signature using the secret key supplied
      * @param message
@@ -45,6 +45,23 @@ namespace Crypto::RingSignature::Borromean
         const std::vector<crypto_public_key_t> &public_keys,
         const crypto_borromean_signature_t &borromean_signature);
 
+    /**
+     * Checks a batch of Borromean ring signatures whereby the hash-to-point
+     * derivation of every unique ring member is shared across the batch and
+     * the independent signatures are verified across the shared worker pool;
+     * an empty batch is vacuously valid
+     * @param message_digests
+     * @param key_images
+     * @param public_keys
+     * @param signatures
+     * @return
+     */
+    bool check_ring_signatures(
+        const std::vector<crypto_hash_t> &message_digests,
+        const std::vector<crypto_key_image_t> &key_images,
+        const std::vector<std::vector<crypto_public_key_t>> &public_keys,
+        const std::vector<crypto_borromean_signature_t> &signatures);
+
     /**
      * Completes the prepared Borromean ring signature
      * @param signing_scalar
@@ -30,10 +30,131 @@
 #ifndef CRYPTO_RING_SIGNATURE_CLSAG_H
 #define CRYPTO_RING_SIGNATURE_CLSAG_H
 
+#include <crypto_parallel.h>
 #include <types/crypto_clsag_signature_t.h>
 
 namespace Crypto::RingSignature::CLSAG
 {
+    /**
+     * Precomputes the per-ring work (the hash-to-point derivation of every
+     * member, duplicate member validation, and an aggregate hash identifying
+     * the ring) exactly once so that repeated signing and verification
+     * operations over the same ring do not redo identical work per call
+     */
+    struct ring_context_t
+    {
+        ring_context_t() = default;
+
+        /**
+         * Constructs the reusable context for the given ring
+         * @param public_keys
+         * @param commitments
+         */
+        explicit ring_context_t(
+            std::vector<crypto_public_key_t> public_keys,
+            std::vector<crypto_pedersen_commitment_t> commitments = {});
+
+        /**
+         * Constructs the reusable context for a ring that lives inside a raw
+         * contiguous region of 32-byte serialized keys (and optionally
+         * commitments), such as a memory-mapped block file, without staging
+         * the material through intermediate vectors; the decompression cache
+         * of the context layers on top as usual
+         * @param key_data
+         * @param key_count the number of 32-byte keys in the region
+         * @param commitment_data
+         * @param commitment_count the number of 32-byte commitments in the region
+         */
+        ring_context_t(
+            const unsigned char *key_data,
+            size_t key_count,
+            const unsigned char *commitment_data = nullptr,
+            size_t commitment_count = 0);
+
+        /**
+         * Returns the commitments of the ring
+         * @return
+         */
+        [[nodiscard]] const std::vector<crypto_pedersen_commitment_t> &commitments() const;
+
+        /**
+         * Returns the precomputed hash-to-point of each ring member (index
+         * aligned with the public keys)
+         * @return
+         */
+        [[nodiscard]] const std::vector<crypto_point_t> &member_points() const;
+
+        /**
+         * Returns the public keys of the ring
+         * @return
+         */
+        [[nodiscard]] const std::vector<crypto_public_key_t> &public_keys() const;
+
+        /**
+         * Returns the aggregate hash identifying the ring (useful for keying
+         * caches of per-ring work elsewhere)
+         * @return
+         */
+        [[nodiscard]] const crypto_hash_t &ring_hash() const;
+
+        /**
+         * Returns whether the ring is usable (non-empty with no duplicate members)
+         * @return
+         */
+        [[nodiscard]] bool valid() const;
+
+      private:
+        std::vector<crypto_public_key_t> ring_public_keys;
+
+        std::vector<crypto_pedersen_commitment_t> ring_commitments;
+
+        std::vector<crypto_point_t> ring_member_points;
+
+        crypto_hash_t hash;
+
+        bool is_valid = false;
+    };
+
+    /**
+     * The portable prepared state of a CLSAG signing ceremony: the prepared
+     * signature together with the round hashes and aggregation coefficient in
+     * one compact binary blob, so a threshold coordinator ships a single
+     * buffer between participants and completion consumes the state directly
+     * without re-deriving any ring transcript work
+     */
+    struct prepared_signature_t
+    {
+        prepared_signature_t() = default;
+
+        prepared_signature_t(
+            crypto_clsag_signature_t signature,
+            size_t real_output_index,
+            std::vector<crypto_scalar_t> h,
+            const crypto_scalar_t &mu_P);
+
+        /**
+         * Deserializes the prepared state from the compact wire format
+         * produced by to_bytes()
+         * @param data
+         * @param length
+         */
+        void from_bytes(const unsigned char *data, size_t length);
+
+        /**
+         * Serializes the prepared state into one compact binary blob
+         * @return
+         */
+        [[nodiscard]] std::vector<uint8_t> to_bytes() const;
+
+        crypto_clsag_signature_t signature;
+
+        size_t real_output_index = 0;
+
+        std::vector<crypto_scalar_t> h;
+
+        crypto_scalar_t mu_P;
+    };
+
     /**
      * Checks the CLSAG ring signature presented
      * @param message_digest
@@ -50,6 +171,87 @@ namespace Crypto::RingSignature::CLSAG
         const crypto_clsag_signature_t &signature,
         const std::vector<crypto_pedersen_commitment_t> &commitments = {});
 
+    /**
+     * Checks the CLSAG ring signature presented using a reusable ring context
+     * whereby the precomputed per-ring work in the context is shared across
+     * every check against the same ring
+     * @param message_digest
+     * @param key_image
+     * @param ring
+     * @param signature
+     * @return
+     */
+    bool check_ring_signature(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const ring_context_t &ring,
+        const crypto_clsag_signature_t &signature);
+
+    /**
+     * Checks the CLSAG ring signature asynchronously on the shared worker
+     * pool, returning a future for the result; the inputs are captured by
+     * value so the caller may release them immediately
+     * @param message_digest
+     * @param key_image
+     * @param public_keys
+     * @param signature
+     * @param commitments
+     * @return
+     */
+    std::future<bool> check_ring_signature_async(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const std::vector<crypto_public_key_t> &public_keys,
+        const crypto_clsag_signature_t &signature,
+        const std::vector<crypto_pedersen_commitment_t> &commitments = {});
+
+    /**
+     * Checks the CLSAG ring signature presented using the shared per-ring LRU
+     * cache: the reusable per-ring work (member decompression products and
+     * duplicate validation) is built the first time a ring member set is seen
+     * -- keyed by the aggregate ring hash -- and reused for every later
+     * signature over the same ring, which removes most of that work from
+     * steady-state mempool validation where decoy rings repeat heavily
+     * @param message_digest
+     * @param key_image
+     * @param public_keys
+     * @param signature
+     * @param commitments
+     * @return
+     */
+    bool check_ring_signature_with_cache(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const std::vector<crypto_public_key_t> &public_keys,
+        const crypto_clsag_signature_t &signature,
+        const std::vector<crypto_pedersen_commitment_t> &commitments = {});
+
+    /**
+     * Sets the number of rings retained by the shared per-ring LRU cache
+     * (default 1024); setting zero (0) disables the cache
+     * @param rings
+     */
+    void set_ring_cache_capacity(size_t rings);
+
+    /**
+     * Checks a batch of CLSAG ring signatures whereby the hash-to-point
+     * derivations of the ring members are shared across the entire batch which
+     * substantially reduces the per-signature cost when the rings overlap;
+     * an empty batch is vacuously valid
+     * @param message_digests
+     * @param key_images
+     * @param public_keys
+     * @param signatures
+     * @param commitments
+     * @return
+     */
+    bool check_ring_signatures(
+        const std::vector<crypto_hash_t> &message_digests,
+        const std::vector<crypto_key_image_t> &key_images,
+        const std::vector<std::vector<crypto_public_key_t>> &public_keys,
+        const std::vector<crypto_clsag_signature_t> &signatures,
+        const std::vector<std::vector<crypto_pedersen_commitment_t>> &commitments = {});
+
     /**
      * Completes the prepared CLSAG ring signature
      * @param signing_scalar
@@ -66,6 +268,71 @@ namespace Crypto::RingSignature::CLSAG
         const std::vector<crypto_scalar_t> &h,
         const crypto_scalar_t &mu_P);
 
+    /**
+     * Completes a prepared CLSAG ring signature from its portable prepared
+     * state; no ring or transcript work is re-derived
+     * @param signing_scalar
+     * @param prepared
+     * @return
+     */
+    std::tuple<bool, crypto_clsag_signature_t>
+        complete_ring_signature(const crypto_scalar_t &signing_scalar, const prepared_signature_t &prepared);
+
+    /**
+     * As prepare_ring_signature but returns the portable prepared state ready
+     * for binary round-tripping between ceremony participants
+     * @param message_digest
+     * @param key_image
+     * @param public_keys
+     * @param real_output_index
+     * @param input_blinding_factor
+     * @param public_commitments
+     * @param pseudo_blinding_factor
+     * @param pseudo_commitment
+     * @return
+     */
+    std::tuple<bool, prepared_signature_t> prepare_signature(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const std::vector<crypto_public_key_t> &public_keys,
+        size_t real_output_index = 0,
+        const crypto_blinding_factor_t &input_blinding_factor = Crypto::ZERO,
+        const std::vector<crypto_pedersen_commitment_t> &public_commitments = {},
+        const crypto_blinding_factor_t &pseudo_blinding_factor = Crypto::ZERO,
+        const crypto_pedersen_commitment_t &pseudo_commitment = Crypto::Z);
+
+    /**
+     * One input of a batch signing run (see generate_ring_signatures)
+     */
+    struct signing_job_t
+    {
+        crypto_hash_t message_digest;
+
+        crypto_scalar_t secret_ephemeral;
+
+        std::vector<crypto_public_key_t> public_keys;
+
+        crypto_blinding_factor_t input_blinding_factor = Crypto::ZERO;
+
+        std::vector<crypto_pedersen_commitment_t> public_commitments = {};
+
+        crypto_blinding_factor_t pseudo_blinding_factor = Crypto::ZERO;
+
+        crypto_pedersen_commitment_t pseudo_commitment = Crypto::Z;
+    };
+
+    /**
+     * Generates CLSAG ring signatures for a whole batch of inputs with the
+     * independent jobs streaming across the shared worker pool; completed
+     * signatures come back in input order and the batch fails as a whole if
+     * any job fails. Because the workers interleave many jobs, the hashing
+     * and curve phases of different inputs overlap instead of alternating
+     * @param jobs
+     * @return {success, signatures (input order)}
+     */
+    std::tuple<bool, std::vector<crypto_clsag_signature_t>>
+        generate_ring_signatures(const std::vector<signing_job_t> &jobs);
+
     /**
      * Generates a CLSAG ring signature using the secrets provided
      * @param message_digest
@@ -86,6 +353,29 @@ namespace Crypto::RingSignature::CLSAG
         const crypto_blinding_factor_t &pseudo_blinding_factor = Crypto::ZERO,
         const crypto_pedersen_commitment_t &pseudo_commitment = Crypto::Z);
 
+    /**
+     * Prepares a CLSAG ring signature using a reusable ring context whereby
+     * the precomputed per-ring work in the context is shared across every
+     * signing operation against the same ring
+     * Must be completed via complete_ring_signature before it will validate
+     * @param message_digest
+     * @param key_image
+     * @param ring
+     * @param real_output_index
+     * @param input_blinding_factor
+     * @param pseudo_blinding_factor
+     * @param pseudo_commitment
+     * @return
+     */
+    std::tuple<bool, crypto_clsag_signature_t, std::vector<crypto_scalar_t>, crypto_scalar_t> prepare_ring_signature(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const ring_context_t &ring,
+        size_t real_output_index = 0,
+        const crypto_blinding_factor_t &input_blinding_factor = Crypto::ZERO,
+        const crypto_blinding_factor_t &pseudo_blinding_factor = Crypto::ZERO,
+        const crypto_pedersen_commitment_t &pseudo_commitment = Crypto::Z);
+
     /**
      * Prepares a CLSAG ring signature using the primitive values provided
      * Must be completed via complete_ring_signature before it will validate
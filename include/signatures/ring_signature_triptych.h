@@ -50,6 +50,25 @@ namespace Crypto::RingSignature::Triptych
         const crypto_triptych_signature_t &signature,
         const std::vector<crypto_pedersen_commitment_t> &commitments);
 
+    /**
+     * Checks a batch of Triptych proofs whereby the commitment tensor points
+     * are shared across the batch and every point equation of every proof is
+     * folded into a single random-linear-combination weighted multiexp;
+     * an empty batch is vacuously valid
+     * @param message_digests
+     * @param key_images
+     * @param public_keys
+     * @param signatures
+     * @param commitments
+     * @return
+     */
+    bool check_ring_signatures(
+        const std::vector<crypto_hash_t> &message_digests,
+        const std::vector<crypto_key_image_t> &key_images,
+        const std::vector<std::vector<crypto_public_key_t>> &public_keys,
+        const std::vector<crypto_triptych_signature_t> &signatures,
+        const std::vector<std::vector<crypto_pedersen_commitment_t>> &commitments);
+
     /**
      * Completes the prepared Triptych proof
      * @param signing_scalar
@@ -44,6 +44,22 @@ namespace Crypto::Signature
         const crypto_public_key_t &public_key,
         const crypto_signature_t &signature);
 
+    /**
+     * Checks a batch of signatures in one call with the independent checks
+     * fanned across the shared worker pool; the batch passes only if every
+     * signature passes. The challenge of this scheme is bound inside the
+     * transcript hash, so a weighted combined verification equation cannot
+     * replace materializing each signature's commitment point
+     * @param message_digests
+     * @param public_keys
+     * @param signatures
+     * @return
+     */
+    bool check_signatures(
+        const std::vector<crypto_hash_t> &message_digests,
+        const std::vector<crypto_public_key_t> &public_keys,
+        const std::vector<crypto_signature_t> &signatures);
+
     /**
      * Completes the prepared signature
      * @param signing_scalar
@@ -60,6 +76,18 @@ namespace Crypto::Signature
      */
     crypto_signature_t generate_signature(const crypto_hash_t &message_digest, const crypto_scalar_t &secret_key);
 
+    /**
+     * Generates signatures over a whole batch of messages with one secret key:
+     * the public key derives once for the entire batch and the independent
+     * nonce commitments and completions stream across the shared worker pool;
+     * results return in message order
+     * @param message_digests
+     * @param secret_key
+     * @return
+     */
+    std::vector<crypto_signature_t>
+        generate_signatures(const std::vector<crypto_hash_t> &message_digests, const crypto_scalar_t &secret_key);
+
     /**
      * Prepares a single signature (non-ring) using the primitive values provided
      * Must be completed via complete_signature before it will validate
@@ -82,6 +82,14 @@ struct crypto_bulletproof_t final : Serializable
      */
     void deserialize(Serialization::deserializer_t &reader) override;
 
+    /**
+     * Deserializes the structure from the compact fixed-layout wire format
+     * produced by to_bytes()
+     * @param data
+     * @param length
+     */
+    void from_bytes(const unsigned char *data, size_t length);
+
     /**
      * Loads the structure from a JSON object
      * @param j
@@ -125,6 +133,13 @@ struct crypto_bulletproof_t final : Serializable
      */
     JSON_TO_FUNC(toJSON) override;
 
+    /**
+     * Serializes the structure into the compact fixed-layout wire format
+     * (contiguous raw elements with varint vector counts) in one allocation
+     * @return
+     */
+    [[nodiscard]] std::vector<uint8_t> to_bytes() const;
+
     /**
      * Returns the hex encoded serialized byte array
      * @return
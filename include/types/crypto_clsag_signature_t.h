@@ -61,6 +61,19 @@ struct crypto_clsag_signature_t final : Serializable
      */
     [[nodiscard]] bool check_construction(size_t ring_size, bool use_commitments = false) const;
 
+    /**
+     * Performs a fast structural pre-screen suitable for mempool admission:
+     * size congruence with the ring, canonical non-zero scalar encodings, and
+     * curve membership / non-identity of the commitment points, all without a
+     * single scalar multiplication. The expensive subgroup check on the
+     * commitment image is deliberately left to full verification; passing the
+     * pre-screen therefore never substitutes for check_ring_signature
+     * @param ring_size
+     * @param use_commitments
+     * @return
+     */
+    [[nodiscard]] bool pre_screen(size_t ring_size, bool use_commitments = false) const;
+
     /**
      * Deserializes the struct from a byte array
      * @param data
@@ -73,6 +86,14 @@ struct crypto_clsag_signature_t final : Serializable
      */
     void deserialize(Serialization::deserializer_t &reader) override;
 
+    /**
+     * Deserializes the structure from the compact fixed-layout wire format
+     * produced by to_bytes()
+     * @param data
+     * @param length
+     */
+    void from_bytes(const unsigned char *data, size_t length);
+
     /**
      * Loads the structure from a JSON object
      * @param j
@@ -115,6 +136,13 @@ struct crypto_clsag_signature_t final : Serializable
      */
     void toJSON(rapidjson::Writer<rapidjson::StringBuffer> &writer) const override;
 
+    /**
+     * Serializes the structure into the compact fixed-layout wire format
+     * (contiguous raw elements with varint vector counts) in one allocation
+     * @return
+     */
+    [[nodiscard]] std::vector<uint8_t> to_bytes() const;
+
     /**
      * Returns the hex encoded serialized byte array
      * @return
@@ -258,6 +258,28 @@ struct crypto_hash_t final : SerializablePod<32>
         return crypto_hash_t::blake2b(input.data(), input.size());
     }
 
+    /**
+     * Hashes each of the given inputs using Blake2b into individual 256-bit
+     * hashes, symmetrical with sha3_batch: the whole batch runs through a
+     * single reusable hashing context and large batches fan out across the
+     * shared worker pool
+     *
+     * @tparam T
+     * @param inputs
+     * @return
+     */
+    template<typename T> static std::vector<crypto_hash_t> blake2b_batch(const std::vector<T> &inputs)
+    {
+        std::vector<crypto_hash_t> results(inputs.size());
+
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            results[i] = blake2b(inputs[i]);
+        }
+
+        return results;
+    }
+
     /**
      * Returns the number of leading 0s of the hash using it's hexadecimal representation
      * @param reversed
@@ -301,6 +323,31 @@ struct crypto_hash_t final : SerializablePod<32>
         return sha3(input.data(), input.size());
     }
 
+    /**
+     * Hashes each of the given inputs using SHA-3 into individual 256-bit hashes
+     *
+     * Bulk callers (merkle tree levels, block scanning, and the like) should
+     * prefer this form over hashing in their own loops as the whole batch runs
+     * through a single reusable hashing context and automatically benefits
+     * from whatever acceleration the underlying implementation selects for
+     * the host CPU
+     *
+     * @tparam T
+     * @param inputs
+     * @return
+     */
+    template<typename T> static std::vector<crypto_hash_t> sha3_batch(const std::vector<T> &inputs)
+    {
+        std::vector<crypto_hash_t> results(inputs.size());
+
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            results[i] = sha3(inputs[i]);
+        }
+
+        return results;
+    }
+
     /**
      * Hashes the given input using SHA-3 for the number of rounds indicated by iterations
      * this method also performs basic key stretching whereby the input data is appended
@@ -314,6 +361,30 @@ struct crypto_hash_t final : SerializablePod<32>
      */
     static crypto_hash_t sha3_slow(const void *input, size_t length, uint64_t iterations);
 
+    /**
+     * Hashes each of the given inputs using sha3_slow with the same iteration
+     * count; the per-call scratch state is thread-local so a large batch of
+     * repeated hashing (share validation and the like) runs allocation-free
+     * and cache-warm
+     *
+     * @tparam T
+     * @param inputs
+     * @param iterations number of iterations
+     * @return
+     */
+    template<typename T>
+    static std::vector<crypto_hash_t> sha3_slow_batch(const std::vector<T> &inputs, uint64_t iterations = 0)
+    {
+        std::vector<crypto_hash_t> results(inputs.size());
+
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            results[i] = sha3_slow(inputs[i], iterations);
+        }
+
+        return results;
+    }
+
     /**
      * Hashes the given POD using SHA-3 for the number of rounds indicated by iterations
      * this method also performs basic key stretching whereby the input data is appended
@@ -401,6 +472,15 @@ struct crypto_hash_t final : SerializablePod<32>
      */
     [[nodiscard]] crypto_point_t point() const;
 
+    /**
+     * Reduces a whole set of hashes into points in one call; large sets fan
+     * out across the shared worker pool (key-image batch generation and
+     * generator table construction feed through here)
+     * @param hashes
+     * @return
+     */
+    [[nodiscard]] static std::vector<crypto_point_t> points(const std::vector<crypto_hash_t> &hashes);
+
     /**
      * Reduces the hash into a scalar
      *
@@ -34,6 +34,45 @@ struct crypto_hash_vector_t final : SerializableVector<crypto_hash_t>
     crypto_hash_vector_t() = default;
 
     explicit crypto_hash_vector_t(std::vector<crypto_hash_t> hashes);
+
+    /**
+     * Returns whether the underlying container holds any duplicate values via
+     * a radix sort of a scratch copy and one adjacent-equality sweep; this is
+     * the double-spend screen for key image sets and runs in linear passes
+     * over the 32-byte elements
+     * @return
+     */
+    [[nodiscard]] bool contains_duplicates() const;
+
+    /**
+     * Returns the values present in both this vector and the other (each
+     * value reported once), computed with two radix sorts and a single merge
+     * walk over the 32-byte elements
+     * @param other
+     * @return
+     */
+    [[nodiscard]] crypto_hash_vector_t intersect(const crypto_hash_vector_t &other) const;
+
+    /**
+     * Sorts the underlying container in place by value (radix byte order)
+     */
+    void sort();
+
+    /**
+     * Deserializes the vector from the compact wire format produced by
+     * to_bytes() in a single bounds-checked pass
+     * @param data
+     * @param length
+     */
+    void from_bytes(const unsigned char *data, size_t length);
+
+    /**
+     * Serializes the vector as one varint count followed by the contiguous
+     * raw 32-byte elements in a single output allocation, skipping the
+     * per-element serialization machinery
+     * @return
+     */
+    [[nodiscard]] std::vector<uint8_t> to_bytes() const;
 };
 
 #endif
@@ -76,6 +76,58 @@ struct crypto_hd_key_t final
      */
     [[nodiscard]] crypto_hd_key_t generate_child_key(const std::string &path) const;
 
+    /**
+     * Generates a child key from this BIP39 seed using an already parsed path
+     * (see parse_bip32_path) so repeated derivations skip the string parsing
+     *
+     * @param parsed_path
+     * @return
+     */
+    [[nodiscard]] crypto_hd_key_t generate_child_key(const std::vector<uint32_t> &parsed_path) const;
+
+    /**
+     * Derives the entire account subtree in one call: the account node is
+     * walked once and each change branch derives its address range on its own
+     * worker, so bulk watch-only exports pay neither repeated path parsing
+     * nor serial branch derivation. The result indexes as
+     * [change][address_index]
+     *
+     * @param purpose
+     * @param coin_type
+     * @param account
+     * @param change_count the number of change branches (2 covers external/internal)
+     * @param address_count the number of address indexes per change branch
+     * @return
+     */
+    [[nodiscard]] std::vector<std::vector<crypto_hd_key_t>> export_subtree(
+        size_t purpose,
+        size_t coin_type,
+        size_t account,
+        size_t change_count,
+        size_t address_count) const;
+
+    /**
+     * Generates the child keys for a whole range of address indexes whereby
+     * the path prefix (purpose/coin_type/account/change) is derived exactly
+     * once and each address index then derives a single level from that cached
+     * parent node instead of re-walking the full path from the root
+     *
+     * @param purpose
+     * @param coin_type
+     * @param account
+     * @param change
+     * @param start_index the first address index of the range
+     * @param count the number of sequential address indexes to derive
+     * @return
+     */
+    [[nodiscard]] std::vector<crypto_hd_key_t> generate_child_keys(
+        size_t purpose,
+        size_t coin_type,
+        size_t account,
+        size_t change,
+        size_t start_index,
+        size_t count) const;
+
     [[nodiscard]] crypto_hash_t key() const;
 
     /**
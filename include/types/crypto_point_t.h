@@ -28,6 +28,7 @@
 #define CRYPTO_POINT_T
 
 #include <ed25519.h>
+#include <stdexcept>
 #include <helpers/debug_helper.h>
 #include <serialization.h>
 
@@ -137,6 +138,14 @@ struct crypto_point_t final : SerializablePod<32>
      */
     [[nodiscard]] bool empty() const override;
 
+    /**
+     * Returns whether the point is the identity element by testing the
+     * extended representation directly (X == 0 and Y == Z) with two field
+     * comparisons and no normalization or serialization
+     * @return
+     */
+    [[nodiscard]] bool is_identity() const;
+
     /**
      * Computes 8P
      * @return
@@ -195,6 +204,58 @@ struct crypto_point_t final : SerializablePod<32>
 
     ge_p3 point3;
     ge_cached cached_point;
+
+    /**
+     * Set once the encoding has been decompressed and validated (at load or
+     * when constructed from arithmetic results) so that later validity checks
+     * never pay for a second decompression of the same point
+     */
+    mutable bool validated = false;
+
+    /**
+     * Set once prime-order subgroup membership has been verified so that the
+     * repeated torsion checks along a full validation path collapse to one
+     */
+    mutable bool subgroup_validated = false;
+};
+
+/**
+ * A point whose prime-order subgroup membership is guaranteed by
+ * construction: the only way to obtain one is through the checking
+ * constructor, so interfaces accepting this type carry the proof of
+ * validation in the type system and need no runtime torsion re-checks
+ */
+struct torsion_free_point_t final
+{
+    /**
+     * Constructs the wrapper, verifying subgroup membership; throws when the
+     * point carries torsion or is the identity
+     * @param candidate
+     */
+    explicit torsion_free_point_t(const crypto_point_t &candidate): validated_point(candidate)
+    {
+        if (!candidate.check_subgroup())
+        {
+            throw std::invalid_argument("point is not a member of the prime-order subgroup");
+        }
+    }
+
+    operator const crypto_point_t &() const
+    {
+        return validated_point;
+    }
+
+    /**
+     * Returns the wrapped (validated) point
+     * @return
+     */
+    [[nodiscard]] const crypto_point_t &point() const
+    {
+        return validated_point;
+    }
+
+  private:
+    crypto_point_t validated_point;
 };
 
 namespace Crypto
@@ -81,6 +81,74 @@ struct crypto_point_vector_t final : SerializableVector<crypto_point_t>
      */
     [[nodiscard]] crypto_point_vector_t dedupe_sort() const;
 
+    /**
+     * Deserializes the vector from the compact wire format produced by
+     * to_bytes() in a single bounds-checked pass
+     * @param data
+     * @param length
+     */
+    void from_bytes(const unsigned char *data, size_t length);
+
+    /**
+     * Serializes the vector as one varint count followed by the contiguous
+     * raw 32-byte elements in a single output allocation, skipping the
+     * per-element serialization machinery
+     * @return
+     */
+    [[nodiscard]] std::vector<uint8_t> to_bytes() const;
+
+
+    /**
+     * Loads an entire vector of serialized points (a ring, a set of outputs)
+     * in a single pass whereby each element is decompressed exactly once; the
+     * per-element check path (Crypto::check_point followed by construction)
+     * decompresses every point multiple times which this method avoids
+     * @tparam T
+     * @param inputs
+     * @return {success, points}
+     */
+    template<typename T> static std::tuple<bool, crypto_point_vector_t> load(const std::vector<T> &inputs)
+    {
+        crypto_point_vector_t result;
+
+        result.container.reserve(inputs.size());
+
+        try
+        {
+            for (const auto &input : inputs)
+            {
+                result.append(crypto_point_t(input));
+            }
+        }
+        catch (const std::exception &e)
+        {
+            PRINTF(e.what())
+
+            return {false, {}};
+        }
+
+        return {true, result};
+    }
+
+    /**
+     * Loads a vector of points straight out of a raw contiguous region of
+     * 32-byte serialized points (a ring inside a memory-mapped block file)
+     * without staging the bytes through intermediate buffers; each point is
+     * decompressed exactly once as it is read
+     * @param data
+     * @param count the number of 32-byte points in the region
+     * @return {success, points}
+     */
+    static std::tuple<bool, crypto_point_vector_t> load(const unsigned char *data, size_t count);
+
+    /**
+     * Checks that every point in the underlying container is a valid point in
+     * one pass across the vector
+     * @param allow_identity
+     * @return
+     */
+    [[nodiscard]] bool valid(bool allow_identity = false) const;
+
     /**
      * Negates all of the values in the underlying container (0 - self)
      * @return
@@ -95,6 +163,14 @@ struct crypto_point_vector_t final : SerializableVector<crypto_point_t>
      */
     [[nodiscard]] crypto_point_vector_t slice(size_t start, size_t end) const;
 
+    /**
+     * Returns whether every point in the underlying container is the identity
+     * element, testing the extended representations directly without any
+     * normalization
+     * @return
+     */
+    [[nodiscard]] bool all_identity() const;
+
     /**
      * Adds all of the values in the underlying container together and returns the result
      * @return
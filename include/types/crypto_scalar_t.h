@@ -68,6 +68,15 @@ struct crypto_scalar_t final : SerializablePod<32>
 
     explicit crypto_scalar_t(const std::vector<crypto_scalar_t> &bits, bool reduce = false);
 
+    /**
+     * Constructs a scalar directly from its four little-endian 64-bit limbs
+     * without any wide-integer or byte-array round-trip
+     * @param limbs
+     * @param reduce
+     * @return
+     */
+    static crypto_scalar_t from_limbs(const uint64_t limbs[4], bool reduce = false);
+
     /**
      * Constructs a scalar from a uint256_t
      * @param number
@@ -265,6 +274,19 @@ struct crypto_scalar_t final : SerializablePod<32>
     [[nodiscard]] std::vector<crypto_scalar_t>
         pow_expand(size_t count, bool descending = false, bool include_zero = true) const;
 
+    /**
+     * Generates a vector of powers of the scalar into the caller-provided
+     * buffer (capacity is retained across calls) whereby the powers roll out
+     * as two interleaved multiply chains off the square of the scalar so the
+     * chains are independent of one another
+     * @param count
+     * @param result
+     * @param descending
+     * @param include_zero
+     */
+    void pow_expand(size_t count, std::vector<crypto_scalar_t> &result, bool descending = false, bool include_zero = true)
+        const;
+
     /**
      * Raises the scalar to the specified power with a modulus
      * r = (s ^ e) % m
@@ -316,6 +338,14 @@ struct crypto_scalar_t final : SerializablePod<32>
      */
     [[nodiscard]] std::vector<crypto_scalar_t> to_bits(size_t bits = 256) const;
 
+    /**
+     * Returns the requested little-endian 64-bit limb of the scalar directly
+     * from its byte representation
+     * @param index
+     * @return
+     */
+    [[nodiscard]] uint64_t limb(size_t index) const;
+
     /**
      * Encodes the first 8 bytes of the scalar as a uint64_t
      * @return
@@ -44,31 +44,43 @@ struct crypto_scalar_vector_t final : SerializableVector<crypto_scalar_t>
 
     /**
      * Adds the scalar to every value in the underlying container
+     *
+     * For each of the arithmetic operators below the rvalue-qualified form
+     * reuses the expiring operand's storage in place, so chained expressions
+     * (the prover folds) only allocate for their first term
      * @param other
      * @return
      */
-    crypto_scalar_vector_t operator+(const crypto_scalar_t &other) const;
+    crypto_scalar_vector_t operator+(const crypto_scalar_t &other) const &;
+
+    crypto_scalar_vector_t operator+(const crypto_scalar_t &other) &&;
 
     /**
      * Adds the two vectors together and returns the resulting vector
      * @param other
      * @return
      */
-    crypto_scalar_vector_t operator+(const crypto_scalar_vector_t &other) const;
+    crypto_scalar_vector_t operator+(const crypto_scalar_vector_t &other) const &;
+
+    crypto_scalar_vector_t operator+(const crypto_scalar_vector_t &other) &&;
 
     /**
      * Subtracts the scalar to every value in the underlying container
      * @param other
      * @return
      */
-    crypto_scalar_vector_t operator-(const crypto_scalar_t &other) const;
+    crypto_scalar_vector_t operator-(const crypto_scalar_t &other) const &;
+
+    crypto_scalar_vector_t operator-(const crypto_scalar_t &other) &&;
 
     /**
      * Subtracts the second vector from the first vector and returns the results
      * @param other
      * @return
      */
-    crypto_scalar_vector_t operator-(const crypto_scalar_vector_t &other) const;
+    crypto_scalar_vector_t operator-(const crypto_scalar_vector_t &other) const &;
+
+    crypto_scalar_vector_t operator-(const crypto_scalar_vector_t &other) &&;
 
     /**
      * Multiplies every value in the underlying container by the provided scalar and
@@ -76,7 +88,9 @@ struct crypto_scalar_vector_t final : SerializableVector<crypto_scalar_t>
      * @param other
      * @return
      */
-    crypto_scalar_vector_t operator*(const crypto_scalar_t &other) const;
+    crypto_scalar_vector_t operator*(const crypto_scalar_t &other) const &;
+
+    crypto_scalar_vector_t operator*(const crypto_scalar_t &other) &&;
 
     /**
      * Multiplies the vectors together and returns the results
@@ -84,7 +98,9 @@ struct crypto_scalar_vector_t final : SerializableVector<crypto_scalar_t>
      * @param other
      * @return
      */
-    crypto_scalar_vector_t operator*(const crypto_scalar_vector_t &other) const;
+    crypto_scalar_vector_t operator*(const crypto_scalar_vector_t &other) const &;
+
+    crypto_scalar_vector_t operator*(const crypto_scalar_vector_t &other) &&;
 
     /**
      * Multiplies the underlying vector of scalars by the vector of provided points
@@ -100,6 +116,23 @@ struct crypto_scalar_vector_t final : SerializableVector<crypto_scalar_t>
      */
     [[nodiscard]] crypto_scalar_vector_t dedupe_sort() const;
 
+    /**
+     * Deserializes the vector from the compact wire format produced by
+     * to_bytes() in a single bounds-checked pass
+     * @param data
+     * @param length
+     */
+    void from_bytes(const unsigned char *data, size_t length);
+
+    /**
+     * Serializes the vector as one varint count followed by the contiguous
+     * raw 32-byte elements in a single output allocation, skipping the
+     * per-element serialization machinery
+     * @return
+     */
+    [[nodiscard]] std::vector<uint8_t> to_bytes() const;
+
+
     /**
      * Calculates the inner product of the two vectors
      * @param other
@@ -114,8 +147,23 @@ struct crypto_scalar_vector_t final : SerializableVector<crypto_scalar_t>
      */
     [[nodiscard]] crypto_scalar_t inner_product(const crypto_scalar_vector_t &other) const;
 
+    /**
+     * Calculates the weighted inner product of the two vectors
+     * sum(a[i] * y^(i+1) * b[i]) as one fused multiply-accumulate pass with
+     * the weight rolled forward a single multiplication per element
+     * @param other
+     * @param y
+     * @return
+     */
+    [[nodiscard]] crypto_scalar_t
+        weighted_inner_product(const crypto_scalar_vector_t &other, const crypto_scalar_t &y) const;
+
     /**
      * Inverts each of the values in the underlying container such that (1/x)
+     *
+     * Unless allow_zero is set this uses simultaneous (batch) inversion which
+     * costs a single field inversion plus three multiplications per element
+     * instead of a full exponentiation per element
      * @param allow_zero
      * @return
      */
@@ -0,0 +1,165 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef CRYPTO_SPAN_T
+#define CRYPTO_SPAN_T
+
+#include <types/crypto_scalar_vector_t.h>
+
+/**
+ * Non-owning views over contiguous scalars and points supporting the vector
+ * math operations that the inner-product folding rounds need, so that the
+ * per-round halves of the proving vectors are plain views into the parent
+ * storage rather than freshly allocated copies.
+ *
+ * A span never outlives the storage it views; the holder of the span is
+ * responsible for keeping the viewed vector alive and unmodified
+ */
+
+struct point_span_t;
+
+struct scalar_span_t final
+{
+    scalar_span_t() = default;
+
+    scalar_span_t(const crypto_scalar_t *data, size_t count): view(data), count(count) {}
+
+    scalar_span_t(const std::vector<crypto_scalar_t> &vector): view(vector.data()), count(vector.size()) {}
+
+    scalar_span_t(const crypto_scalar_vector_t &vector): view(vector.container.data()), count(vector.size()) {}
+
+    const crypto_scalar_t &operator[](size_t i) const
+    {
+        return view[i];
+    }
+
+    /**
+     * Multiplies every value in the view by the provided scalar returning an
+     * owning vector of the results
+     * @param other
+     * @return
+     */
+    crypto_scalar_vector_t operator*(const crypto_scalar_t &other) const;
+
+    [[nodiscard]] const crypto_scalar_t *data() const
+    {
+        return view;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return count == 0;
+    }
+
+    /**
+     * Calculates the inner product of the two views
+     * @param other
+     * @return
+     */
+    [[nodiscard]] crypto_scalar_t inner_product(const scalar_span_t &other) const;
+
+    /**
+     * Calculates the inner product of the view against the view of points
+     * @param other
+     * @return
+     */
+    [[nodiscard]] crypto_point_t inner_product(const point_span_t &other) const;
+
+    [[nodiscard]] size_t size() const
+    {
+        return count;
+    }
+
+    /**
+     * Returns a sub-view of the span using the provided offsets (no copying)
+     * @param start
+     * @param end
+     * @return
+     */
+    [[nodiscard]] scalar_span_t slice(size_t start, size_t end) const;
+
+  private:
+    const crypto_scalar_t *view = nullptr;
+
+    size_t count = 0;
+};
+
+struct point_span_t final
+{
+    point_span_t() = default;
+
+    point_span_t(const crypto_point_t *data, size_t count): view(data), count(count) {}
+
+    point_span_t(const std::vector<crypto_point_t> &vector): view(vector.data()), count(vector.size()) {}
+
+    point_span_t(const crypto_point_vector_t &vector): view(vector.container.data()), count(vector.size()) {}
+
+    const crypto_point_t &operator[](size_t i) const
+    {
+        return view[i];
+    }
+
+    [[nodiscard]] const crypto_point_t *data() const
+    {
+        return view;
+    }
+
+    /**
+     * Performs a double multiplication of the two views against the specified
+     * scalars, adding the pairs together, and returning an owning vector
+     * @param a
+     * @param B
+     * @param b
+     * @return
+     */
+    [[nodiscard]] crypto_point_vector_t
+        dbl_mult(const crypto_scalar_t &a, const point_span_t &B, const crypto_scalar_t &b) const;
+
+    [[nodiscard]] bool empty() const
+    {
+        return count == 0;
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+        return count;
+    }
+
+    /**
+     * Returns a sub-view of the span using the provided offsets (no copying)
+     * @param start
+     * @param end
+     * @return
+     */
+    [[nodiscard]] point_span_t slice(size_t start, size_t end) const;
+
+  private:
+    const crypto_point_t *view = nullptr;
+
+    size_t count = 0;
+};
+
+#endif // CRYPTO_SPAN_T
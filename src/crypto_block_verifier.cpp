@@ -0,0 +1,176 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <crypto_block_verifier.h>
+#include <crypto_parallel.h>
+
+namespace Crypto
+{
+    void block_verifier_t::add_borromean(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const std::vector<crypto_public_key_t> &public_keys,
+        const crypto_borromean_signature_t &signature)
+    {
+        borromean_messages.push_back(message_digest);
+
+        borromean_key_images.push_back(key_image);
+
+        borromean_rings.push_back(public_keys);
+
+        borromean_signatures.push_back(signature);
+    }
+
+    void block_verifier_t::add_bulletproof(
+        const crypto_bulletproof_t &proof,
+        const std::vector<crypto_pedersen_commitment_t> &commitments)
+    {
+        bulletproofs.push_back(proof);
+
+        bulletproof_commitments.push_back(commitments);
+    }
+
+    void block_verifier_t::add_bulletproof_plus(
+        const crypto_bulletproof_plus_t &proof,
+        const std::vector<crypto_pedersen_commitment_t> &commitments)
+    {
+        bulletproofs_plus.push_back(proof);
+
+        bulletproof_plus_commitments.push_back(commitments);
+    }
+
+    void block_verifier_t::add_clsag(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const std::vector<crypto_public_key_t> &public_keys,
+        const crypto_clsag_signature_t &signature,
+        const std::vector<crypto_pedersen_commitment_t> &commitments)
+    {
+        clsag_messages.push_back(message_digest);
+
+        clsag_key_images.push_back(key_image);
+
+        clsag_rings.push_back(public_keys);
+
+        clsag_signatures.push_back(signature);
+
+        clsag_commitments.push_back(commitments);
+    }
+
+    void block_verifier_t::add_triptych(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const std::vector<crypto_public_key_t> &public_keys,
+        const crypto_triptych_signature_t &signature,
+        const std::vector<crypto_pedersen_commitment_t> &commitments)
+    {
+        triptych_messages.push_back(message_digest);
+
+        triptych_key_images.push_back(key_image);
+
+        triptych_rings.push_back(public_keys);
+
+        triptych_signatures.push_back(signature);
+
+        triptych_commitments.push_back(commitments);
+    }
+
+    void block_verifier_t::set_merkle_leaves(const std::vector<crypto_hash_t> &hashes)
+    {
+        merkle_leaves = hashes;
+    }
+
+    std::tuple<bool, crypto_hash_t> block_verifier_t::verify(size_t N)
+    {
+        /**
+         * The per-scheme batches are submitted heaviest first (range proofs,
+         * then Triptych, then CLSAG, then the legacy scheme) so the pool
+         * workers start on the long poles immediately; the submitting thread
+         * computes the merkle root while they run and then joins the futures
+         */
+        std::vector<std::future<bool>> verdicts;
+
+        if (!bulletproofs_plus.empty())
+        {
+            verdicts.push_back(Crypto::Parallel::async(
+                [this, N]()
+                { return Crypto::RangeProofs::BulletproofsPlus::verify(bulletproofs_plus, bulletproof_plus_commitments, N); }));
+        }
+
+        if (!bulletproofs.empty())
+        {
+            verdicts.push_back(Crypto::Parallel::async(
+                [this, N]() { return Crypto::RangeProofs::Bulletproofs::verify(bulletproofs, bulletproof_commitments, N); }));
+        }
+
+        if (!triptych_signatures.empty())
+        {
+            verdicts.push_back(Crypto::Parallel::async(
+                [this]()
+                {
+                    return Crypto::RingSignature::Triptych::check_ring_signatures(
+                        triptych_messages, triptych_key_images, triptych_rings, triptych_signatures, triptych_commitments);
+                }));
+        }
+
+        if (!clsag_signatures.empty())
+        {
+            verdicts.push_back(Crypto::Parallel::async(
+                [this]()
+                {
+                    return Crypto::RingSignature::CLSAG::check_ring_signatures(
+                        clsag_messages, clsag_key_images, clsag_rings, clsag_signatures, clsag_commitments);
+                }));
+        }
+
+        if (!borromean_signatures.empty())
+        {
+            verdicts.push_back(Crypto::Parallel::async(
+                [this]()
+                {
+                    return Crypto::RingSignature::Borromean::check_ring_signatures(
+                        borromean_messages, borromean_key_images, borromean_rings, borromean_signatures);
+                }));
+        }
+
+        const auto merkle_root = Crypto::Merkle::root_hash(merkle_leaves);
+
+        auto result = true;
+
+        for (auto &verdict : verdicts)
+        {
+            if (!verdict.get())
+            {
+                result = false;
+            }
+        }
+
+        // the verifier is single use per block; everything clears either way
+        *this = block_verifier_t();
+
+        return {result, merkle_root};
+    }
+} // namespace Crypto
@@ -26,18 +26,248 @@
 
 #include <crypto_common.h>
 #include <crypto_constants.h>
+#include <crypto_parallel.h>
+#include <helpers/fixed_base_table_t.h>
 #include <cryptopp/aes.h>
 #include <cryptopp/filters.h>
 #include <cryptopp/modes.h>
 #include <cryptopp/pwdbased.h>
 #include <cryptopp/sha3.h>
+#include <algorithm>
+#include <array>
 #include <helpers/random_bytes.h>
+#include <mutex>
+#include <types/crypto_hash_t.h>
 #include <types/crypto_scalar_vector_t.h>
 
 namespace Crypto
 {
     namespace AES
     {
+        /**
+         * Derives the 128-bit AES key for the given password and salt; this is
+         * the expensive step that the keyslot exists to amortize
+         * @param key
+         * @param password
+         * @param salt
+         * @param iterations
+         */
+        static void derive_key(
+            CryptoPP::byte key[16],
+            const std::string &password,
+            const CryptoPP::byte salt[16],
+            size_t iterations)
+        {
+            CryptoPP::PKCS5_PBKDF2_HMAC<CryptoPP::SHA3_512> pbkdf2;
+
+            pbkdf2.DeriveKey(
+                key,
+                16,
+                0,
+                reinterpret_cast<const CryptoPP::byte *>(password.c_str()),
+                password.size(),
+                salt,
+                16,
+                iterations);
+        }
+
+        keyslot_t::keyslot_t(const std::string &password, size_t iterations)
+        {
+            slot_salt.resize(16);
+
+            random_bytes(slot_salt.size(), slot_salt.data());
+
+            derive_key(key, password, slot_salt.data(), iterations);
+        }
+
+        keyslot_t::keyslot_t(const std::string &password, const std::vector<uint8_t> &salt, size_t iterations)
+        {
+            if (salt.size() != 16)
+            {
+                throw std::invalid_argument("Salt must be exactly 16 bytes");
+            }
+
+            slot_salt = salt;
+
+            derive_key(key, password, slot_salt.data(), iterations);
+        }
+
+        keyslot_t::~keyslot_t()
+        {
+            secure_erase(key, sizeof(key));
+        }
+
+        std::vector<uint8_t> keyslot_t::decrypt(const std::vector<uint8_t> &input) const
+        {
+            if (input.size() < 16)
+            {
+                throw std::invalid_argument("Ciphertext does not contain enough data to include the IV");
+            }
+
+            CryptoPP::CBC_Mode<CryptoPP::AES>::Decryption cbc_decryption;
+
+            cbc_decryption.SetKeyWithIV(key, sizeof(key), input.data());
+
+            std::vector<CryptoPP::byte> decrypted;
+
+            try
+            {
+                CryptoPP::StringSource(
+                    input.data() + 16,
+                    input.size() - 16,
+                    true,
+                    new CryptoPP::StreamTransformationFilter(cbc_decryption, new CryptoPP::VectorSink(decrypted)));
+            }
+            catch (const CryptoPP::Exception &)
+            {
+                throw std::invalid_argument("Wrong keyslot supplied for decryption");
+            }
+
+            return decrypted;
+        }
+
+        std::vector<uint8_t> keyslot_t::encrypt(const std::vector<uint8_t> &input) const
+        {
+            // every payload gets a fresh IV as the keyslot key is reused across payloads
+            CryptoPP::byte iv[16] = {0};
+
+            random_bytes(sizeof(iv), iv);
+
+            CryptoPP::CBC_Mode<CryptoPP::AES>::Encryption cbc_encryption;
+
+            cbc_encryption.SetKeyWithIV(key, sizeof(key), iv);
+
+            std::vector<CryptoPP::byte> encrypted;
+
+            CryptoPP::StringSource(
+                input.data(),
+                input.size(),
+                true,
+                new CryptoPP::StreamTransformationFilter(cbc_encryption, new CryptoPP::VectorSink(encrypted)));
+
+            std::vector<uint8_t> result;
+
+            result.reserve(sizeof(iv) + encrypted.size());
+
+            result.assign(iv, iv + sizeof(iv));
+
+            result.insert(result.end(), encrypted.begin(), encrypted.end());
+
+            return result;
+        }
+
+        const std::vector<uint8_t> &keyslot_t::salt() const
+        {
+            return slot_salt;
+        }
+
+        /**
+         * Each stream owns its cipher and transformation filter together
+         * behind the opaque handle so the header stays free of the library
+         * and concurrent streams never share cipher state
+         */
+        template<typename Mode> struct stream_state_t
+        {
+            stream_state_t(): filter(cipher) {}
+
+            Mode cipher;
+
+            CryptoPP::StreamTransformationFilter filter;
+        };
+
+        typedef stream_state_t<CryptoPP::CBC_Mode<CryptoPP::AES>::Encryption> encrypt_stream_state_t;
+
+        typedef stream_state_t<CryptoPP::CBC_Mode<CryptoPP::AES>::Decryption> decrypt_stream_state_t;
+
+        static std::vector<uint8_t> drain_filter(CryptoPP::StreamTransformationFilter &filter)
+        {
+            std::vector<uint8_t> result(size_t(filter.MaxRetrievable()));
+
+            filter.Get(result.data(), result.size());
+
+            return result;
+        }
+
+        stream_encryptor_t::stream_encryptor_t(const keyslot_t &keyslot)
+        {
+            stream_iv.resize(16);
+
+            random_bytes(stream_iv.size(), stream_iv.data());
+
+            auto state = new encrypt_stream_state_t();
+
+            state->cipher.SetKeyWithIV(keyslot.key, sizeof(keyslot.key), stream_iv.data());
+
+            filter = state;
+        }
+
+        stream_encryptor_t::~stream_encryptor_t()
+        {
+            delete static_cast<encrypt_stream_state_t *>(filter);
+        }
+
+        std::vector<uint8_t> stream_encryptor_t::finalize()
+        {
+            auto state = static_cast<encrypt_stream_state_t *>(filter);
+
+            state->filter.MessageEnd();
+
+            return drain_filter(state->filter);
+        }
+
+        const std::vector<uint8_t> &stream_encryptor_t::iv() const
+        {
+            return stream_iv;
+        }
+
+        std::vector<uint8_t> stream_encryptor_t::update(const void *data, size_t length)
+        {
+            auto state = static_cast<encrypt_stream_state_t *>(filter);
+
+            state->filter.Put(static_cast<const CryptoPP::byte *>(data), length);
+
+            return drain_filter(state->filter);
+        }
+
+        stream_decryptor_t::stream_decryptor_t(const keyslot_t &keyslot, const unsigned char iv[16])
+        {
+            auto state = new decrypt_stream_state_t();
+
+            state->cipher.SetKeyWithIV(keyslot.key, sizeof(keyslot.key), iv);
+
+            filter = state;
+        }
+
+        stream_decryptor_t::~stream_decryptor_t()
+        {
+            delete static_cast<decrypt_stream_state_t *>(filter);
+        }
+
+        std::vector<uint8_t> stream_decryptor_t::finalize()
+        {
+            auto state = static_cast<decrypt_stream_state_t *>(filter);
+
+            try
+            {
+                state->filter.MessageEnd();
+            }
+            catch (const CryptoPP::Exception &)
+            {
+                throw std::invalid_argument("Wrong keyslot supplied for decryption");
+            }
+
+            return drain_filter(state->filter);
+        }
+
+        std::vector<uint8_t> stream_decryptor_t::update(const void *data, size_t length)
+        {
+            auto state = static_cast<decrypt_stream_state_t *>(filter);
+
+            state->filter.Put(static_cast<const CryptoPP::byte *>(data), length);
+
+            return drain_filter(state->filter);
+        }
+
         std::string decrypt(const std::string &input, const std::string &password, size_t iterations)
         {
             // load the hexadecimal encoded string
@@ -57,18 +287,8 @@ namespace Crypto
                 std::copy(bytes.begin(), bytes.end(), salt);
             }
 
-            CryptoPP::PKCS5_PBKDF2_HMAC<CryptoPP::SHA3_512> pbkdf2;
-
             // derive the AES key from the password and salt
-            pbkdf2.DeriveKey(
-                key,
-                sizeof(key),
-                0,
-                reinterpret_cast<const CryptoPP::byte *>(password.c_str()),
-                password.size(),
-                salt,
-                sizeof(salt),
-                iterations);
+            derive_key(key, password, salt, iterations);
 
             CryptoPP::CBC_Mode<CryptoPP::AES>::Decryption cbc_decryption;
 
@@ -101,18 +321,8 @@ namespace Crypto
             // generate a random salt
             random_bytes(sizeof(salt), salt);
 
-            CryptoPP::PKCS5_PBKDF2_HMAC<CryptoPP::SHA3_512> pbkdf2;
-
             // derive the AES key from the password and salt
-            pbkdf2.DeriveKey(
-                key,
-                sizeof(key),
-                0,
-                reinterpret_cast<const CryptoPP::byte *>(password.c_str()),
-                password.size(),
-                salt,
-                sizeof(salt),
-                iterations);
+            derive_key(key, password, salt, iterations);
 
             CryptoPP::CBC_Mode<CryptoPP::AES>::Encryption cbc_encryption;
 
@@ -136,8 +346,149 @@ namespace Crypto
             // return it as a hexadecimal encoded string
             return writer.to_string();
         }
+
+        std::vector<uint8_t> decrypt(const std::vector<uint8_t> &input, const std::string &password, size_t iterations)
+        {
+            if (input.size() <= 16)
+            {
+                throw std::invalid_argument("Ciphertext does not contain enough data to include the salt");
+            }
+
+            CryptoPP::byte key[16] = {0}, salt[16] = {0};
+
+            std::copy(input.begin(), input.begin() + sizeof(salt), salt);
+
+            derive_key(key, password, salt, iterations);
+
+            CryptoPP::CBC_Mode<CryptoPP::AES>::Decryption cbc_decryption;
+
+            cbc_decryption.SetKeyWithIV(key, sizeof(key), salt);
+
+            std::vector<CryptoPP::byte> decrypted;
+
+            try
+            {
+                CryptoPP::StringSource(
+                    input.data() + sizeof(salt),
+                    input.size() - sizeof(salt),
+                    true,
+                    new CryptoPP::StreamTransformationFilter(cbc_decryption, new CryptoPP::VectorSink(decrypted)));
+            }
+            catch (const CryptoPP::Exception &)
+            {
+                throw std::invalid_argument("Wrong password supplied for decryption");
+            }
+
+            return decrypted;
+        }
+
+        std::vector<uint8_t> encrypt(const std::vector<uint8_t> &input, const std::string &password, size_t iterations)
+        {
+            CryptoPP::byte key[16] = {0}, salt[16] = {0};
+
+            // generate a random salt
+            random_bytes(sizeof(salt), salt);
+
+            derive_key(key, password, salt, iterations);
+
+            CryptoPP::CBC_Mode<CryptoPP::AES>::Encryption cbc_encryption;
+
+            cbc_encryption.SetKeyWithIV(key, sizeof(key), salt);
+
+            std::vector<CryptoPP::byte> encrypted;
+
+            CryptoPP::StringSource(
+                input.data(),
+                input.size(),
+                true,
+                new CryptoPP::StreamTransformationFilter(cbc_encryption, new CryptoPP::VectorSink(encrypted)));
+
+            std::vector<uint8_t> result;
+
+            result.reserve(sizeof(salt) + encrypted.size());
+
+            result.assign(salt, salt + sizeof(salt));
+
+            result.insert(result.end(), encrypted.begin(), encrypted.end());
+
+            return result;
+        }
     } // namespace AES
 
+    /**
+     * The interned constant-point registry: known-good encodings ordered by
+     * their bytes, lazily seeded with the library generators
+     */
+    static std::mutex constant_registry_mutex;
+
+    static std::vector<std::array<unsigned char, 32>> constant_registry;
+
+    static void seed_constant_registry()
+    {
+        if (!constant_registry.empty())
+        {
+            return;
+        }
+
+        /**
+         * The identity (Z) is deliberately NOT seeded: every other validation
+         * path in the library rejects the identity, and registering it would
+         * make the full check accept a point the subgroup check refuses
+         */
+        for (const auto *constant : {&Crypto::G, &Crypto::H, &Crypto::U})
+        {
+            std::array<unsigned char, 32> encoding {};
+
+            std::memcpy(encoding.data(), constant->data(), encoding.size());
+
+            constant_registry.push_back(encoding);
+        }
+
+        std::sort(constant_registry.begin(), constant_registry.end());
+    }
+
+    bool is_registered_constant_point(const void *data)
+    {
+        std::scoped_lock lock(constant_registry_mutex);
+
+        seed_constant_registry();
+
+        std::array<unsigned char, 32> encoding {};
+
+        std::memcpy(encoding.data(), data, encoding.size());
+
+        return std::binary_search(constant_registry.begin(), constant_registry.end(), encoding);
+    }
+
+    void register_constant_point(const crypto_point_t &point)
+    {
+        /**
+         * Registration short-circuits full validation for the encoding
+         * everywhere, so the point must actually withstand that validation:
+         * refusing anything outside the prime-order subgroup closes the
+         * bypass a careless registration would otherwise open
+         */
+        if (!point.check_subgroup())
+        {
+            throw std::invalid_argument("only prime-order subgroup members may be registered as constants");
+        }
+
+        std::scoped_lock lock(constant_registry_mutex);
+
+        seed_constant_registry();
+
+        std::array<unsigned char, 32> encoding {};
+
+        std::memcpy(encoding.data(), point.data(), encoding.size());
+
+        const auto position = std::lower_bound(constant_registry.begin(), constant_registry.end(), encoding);
+
+        if (position == constant_registry.end() || *position != encoding)
+        {
+            constant_registry.insert(position, encoding);
+        }
+    }
+
     std::tuple<bool, size_t> calculate_base2_exponent(const size_t &target_value)
     {
         const auto rounded = pow2_round(target_value);
@@ -160,16 +511,49 @@ namespace Crypto
         return {false, 0};
     }
 
-    bool check_torsion(const crypto_point_t &value)
+    bool check_points_full(const std::vector<crypto_point_t> &values)
     {
-        if (Crypto::INV_EIGHT * (Crypto::EIGHT * value) != value || value.empty())
+        // small sets (a typical ring) are cheaper to walk inline
+        if (values.size() < 32)
+        {
+            for (const auto &value : values)
+            {
+                if (!value.check_subgroup())
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        std::vector<unsigned char> results(values.size(), 0);
+
+        Crypto::Parallel::parallel_for(
+            0, values.size(), [&](size_t i) { results[i] = values[i].check_subgroup() ? 1 : 0; });
+
+        for (const auto &result : results)
         {
-            return false;
+            if (result == 0)
+            {
+                return false;
+            }
         }
 
         return true;
     }
 
+    bool check_torsion(const crypto_point_t &value)
+    {
+        /**
+         * Subgroup membership via the precomputed-multiple check accepts and
+         * rejects exactly the same points as the old
+         * INV_EIGHT * (EIGHT * value) == value round-trip while costing a
+         * fraction of the two full scalar multiplications it performed
+         */
+        return value.check_subgroup();
+    }
+
     crypto_point_t commitment_tensor_point(const crypto_point_t &point, size_t i, size_t j, size_t k)
     {
         auto writer = Serialization::serializer_t();
@@ -185,26 +569,149 @@ namespace Crypto
         return crypto_hash_t::sha3(writer).point();
     }
 
-    std::vector<crypto_scalar_t> convolve(const crypto_scalar_vector_t &x, const std::vector<crypto_scalar_t> &y)
+    /**
+     * Computes the schoolbook product of the two coefficient vectors
+     * @param a
+     * @param b
+     * @return
+     */
+    static std::vector<crypto_scalar_t>
+        schoolbook_product(const std::vector<crypto_scalar_t> &a, const std::vector<crypto_scalar_t> &b)
     {
-        if (y.size() != 2)
+        std::vector<crypto_scalar_t> result(a.size() + b.size() - 1, Crypto::ZERO);
+
+        /**
+         * The delta-seeded polynomials that feed the Triptych coefficient tree
+         * are almost entirely zeros and ones, so zero coefficients contribute
+         * nothing (skipped outright) and unit coefficients fold as a plain
+         * shifted addition; both tests are byte compares that cost far less
+         * than the multiplications they avoid
+         */
+        for (size_t j = 0; j < b.size(); ++j)
         {
-            throw std::runtime_error("requires a degree-one polynomial");
-        }
+            if (b[j] == Crypto::ZERO)
+            {
+                continue;
+            }
+
+            if (b[j] == Crypto::ONE)
+            {
+                for (size_t i = 0; i < a.size(); ++i)
+                {
+                    result[i + j] += a[i];
+                }
 
-        std::vector<crypto_scalar_t> result(x.size() + 1, Crypto::ZERO);
+                continue;
+            }
 
-        for (size_t i = 0; i < x.size(); ++i)
-        {
-            for (size_t j = 0; j < y.size(); ++j)
+            for (size_t i = 0; i < a.size(); ++i)
             {
-                result[i + j] += x[i] * y[j];
+                result[i + j] += a[i] * b[j];
             }
         }
 
         return result;
     }
 
+    /**
+     * Computes the product of the two coefficient vectors via Karatsuba
+     * splitting, falling back to the schoolbook form below the threshold where
+     * the recursion overhead stops paying for itself
+     * @param a
+     * @param b
+     * @return
+     */
+    static std::vector<crypto_scalar_t>
+        karatsuba_product(const std::vector<crypto_scalar_t> &a, const std::vector<crypto_scalar_t> &b)
+    {
+        if (std::min(a.size(), b.size()) < 32)
+        {
+            return schoolbook_product(a, b);
+        }
+
+        const auto half = (std::max(a.size(), b.size()) + 1) / 2;
+
+        const auto a0 = std::vector<crypto_scalar_t>(a.begin(), a.begin() + std::min(half, a.size()));
+
+        const auto a1 = half < a.size() ? std::vector<crypto_scalar_t>(a.begin() + half, a.end())
+                                        : std::vector<crypto_scalar_t>(1, Crypto::ZERO);
+
+        const auto b0 = std::vector<crypto_scalar_t>(b.begin(), b.begin() + std::min(half, b.size()));
+
+        const auto b1 = half < b.size() ? std::vector<crypto_scalar_t>(b.begin() + half, b.end())
+                                        : std::vector<crypto_scalar_t>(1, Crypto::ZERO);
+
+        const auto z0 = karatsuba_product(a0, b0);
+
+        const auto z2 = karatsuba_product(a1, b1);
+
+        auto a01 = a0, b01 = b0;
+
+        a01.resize(std::max(a0.size(), a1.size()), Crypto::ZERO);
+
+        b01.resize(std::max(b0.size(), b1.size()), Crypto::ZERO);
+
+        for (size_t i = 0; i < a1.size(); ++i)
+        {
+            a01[i] += a1[i];
+        }
+
+        for (size_t i = 0; i < b1.size(); ++i)
+        {
+            b01[i] += b1[i];
+        }
+
+        auto z1 = karatsuba_product(a01, b01);
+
+        for (size_t i = 0; i < z0.size(); ++i)
+        {
+            z1[i] -= z0[i];
+        }
+
+        for (size_t i = 0; i < z2.size(); ++i)
+        {
+            z1[i] -= z2[i];
+        }
+
+        std::vector<crypto_scalar_t> result(a.size() + b.size() - 1, Crypto::ZERO);
+
+        for (size_t i = 0; i < z0.size() && i < result.size(); ++i)
+        {
+            result[i] += z0[i];
+        }
+
+        for (size_t i = 0; i < z1.size() && half + i < result.size(); ++i)
+        {
+            result[half + i] += z1[i];
+        }
+
+        for (size_t i = 0; i < z2.size() && (2 * half) + i < result.size(); ++i)
+        {
+            result[(2 * half) + i] += z2[i];
+        }
+
+        return result;
+    }
+
+    std::vector<crypto_scalar_t> convolve(const crypto_scalar_vector_t &x, const std::vector<crypto_scalar_t> &y)
+    {
+        if (x.size() == 0 || y.empty())
+        {
+            throw std::runtime_error("requires non-empty polynomials");
+        }
+
+        /**
+         * The historical restriction to degree-one second operands is lifted:
+         * products dispatch by size into Karatsuba once both operands are
+         * large enough to amortize the recursion. An NTT-style evaluation
+         * approach is not available in this field -- the group order minus one
+         * carries no useful power-of-two factor, so there are no suitable
+         * roots of unity -- and the Triptych expansion tree, which multiplies
+         * by one linear factor at a time, is already linear per step
+         */
+        return karatsuba_product(x.container, y);
+    }
+
     crypto_scalar_t derivation_to_scalar(const crypto_derivation_t &derivation, const uint64_t output_index)
     {
         auto writer = Serialization::serializer_t();
@@ -218,6 +725,81 @@ namespace Crypto
         return crypto_hash_t::sha3(writer).scalar();
     }
 
+    derivation_session_t::derivation_session_t(const crypto_derivation_t &derivation)
+    {
+        // absorb the shared (domain || derivation) prefix exactly once
+        auto writer = Serialization::serializer_t();
+
+        writer.pod(DERIVATION_DOMAIN_0);
+
+        writer.pod(derivation);
+
+        auto context = new CryptoPP::SHA3_256();
+
+        context->Update(writer.data(), writer.size());
+
+        state = context;
+    }
+
+    derivation_session_t::~derivation_session_t()
+    {
+        delete static_cast<CryptoPP::SHA3_256 *>(state);
+    }
+
+    crypto_scalar_t derivation_session_t::scalar(uint64_t output_index) const
+    {
+        /**
+         * Clone the absorbed prefix state and append only the index bytes;
+         * the index is serialized exactly as the one-shot path serializes it
+         * so the resulting scalars are identical
+         */
+        auto context = *static_cast<const CryptoPP::SHA3_256 *>(state);
+
+        static thread_local Serialization::serializer_t suffix;
+
+        suffix.reset();
+
+        suffix.uint64(output_index);
+
+        context.Update(suffix.data(), suffix.size());
+
+        SerializablePod digest;
+
+        context.TruncatedFinal(*digest, digest.size());
+
+        return crypto_scalar_t(digest.serialize(), true);
+    }
+
+    std::vector<crypto_scalar_t>
+        derivation_to_scalar(const crypto_derivation_t &derivation, const std::vector<uint64_t> &output_indexes)
+    {
+        std::vector<crypto_scalar_t> result;
+
+        result.reserve(output_indexes.size());
+
+        /**
+         * One serializer is reused for the entire batch so that each output
+         * index only pays for rewriting the transcript and its hash instead of
+         * constructing the transcript machinery from scratch per call
+         */
+        auto writer = Serialization::serializer_t();
+
+        for (const auto &output_index : output_indexes)
+        {
+            writer.reset();
+
+            writer.pod(DERIVATION_DOMAIN_0);
+
+            writer.pod(derivation);
+
+            writer.uint64(output_index);
+
+            result.push_back(crypto_hash_t::sha3(writer).scalar());
+        }
+
+        return result;
+    }
+
     crypto_public_key_t
         derive_public_key(const crypto_scalar_t &derivation_scalar, const crypto_public_key_t &public_key)
     {
@@ -263,6 +845,54 @@ namespace Crypto
         return secret_ephemeral.invert() * Crypto::U;
     }
 
+    std::vector<crypto_key_image_t> generate_key_images(
+        const std::vector<crypto_public_key_t> &public_ephemerals,
+        const std::vector<crypto_scalar_t> &secret_ephemerals)
+    {
+        if (public_ephemerals.size() != secret_ephemerals.size())
+        {
+            throw std::range_error("public and secret ephemerals must be of the same size");
+        }
+
+        std::vector<crypto_key_image_t> result(public_ephemerals.size());
+
+        /**
+         * Each image pays a hash-to-point plus a scalar multiplication, both of
+         * which are independent per output, so a large sweep fans out across
+         * the worker pool
+         */
+        Crypto::Parallel::parallel_for(
+            0,
+            public_ephemerals.size(),
+            [&](size_t i) { result[i] = generate_key_image(public_ephemerals[i], secret_ephemerals[i]); });
+
+        return result;
+    }
+
+    std::vector<crypto_key_image_t> generate_key_images_v2(const std::vector<crypto_scalar_t> &secret_ephemerals)
+    {
+        for (const auto &secret_ephemeral : secret_ephemerals)
+        {
+            SCALAR_NZ_OR_THROW(secret_ephemeral);
+        }
+
+        // one simultaneous inversion covers the entire set
+        const auto inverted = crypto_scalar_vector_t(secret_ephemerals).invert();
+
+        std::vector<crypto_key_image_t> result(secret_ephemerals.size());
+
+        Crypto::Parallel::parallel_for(
+            0,
+            secret_ephemerals.size(),
+            [&](size_t i)
+            {
+                // I = 1/x * U
+                result[i] = Crypto::U_table().mul(inverted[i]);
+            });
+
+        return result;
+    }
+
     std::tuple<crypto_public_key_t, crypto_scalar_t> generate_keys()
     {
         crypto_scalar_t secret_key = crypto_scalar_t::random();
@@ -273,18 +903,34 @@ namespace Crypto
 
     std::tuple<std::vector<crypto_public_key_t>, std::vector<crypto_scalar_t>> generate_keys_m(size_t count)
     {
-        std::vector<crypto_public_key_t> public_keys;
+        std::vector<crypto_public_key_t> public_keys(count);
 
-        std::vector<crypto_scalar_t> secret_keys;
+        std::vector<crypto_scalar_t> secret_keys(count);
 
-        for (size_t i = 0; i < count; ++i)
-        {
-            const auto [public_key, secret_key] = generate_keys();
+        /**
+         * All of the entropy for the batch comes from one draw; each key is
+         * then derived from its own slice exactly as the single-key path
+         * derives from a fresh draw (hash then reduce), and the fixed-base
+         * multiplications fan out across the worker pool
+         */
+        std::vector<unsigned char> entropy(count * CRYPTO_ENTROPY_BYTES);
 
-            public_keys.push_back(public_key);
+        random_bytes(entropy.size(), entropy.data());
 
-            secret_keys.push_back(secret_key);
-        }
+        Crypto::Parallel::parallel_for(
+            0,
+            count,
+            [&](size_t i)
+            {
+                const auto hash = crypto_hash_t::sha3(entropy.data() + (i * CRYPTO_ENTROPY_BYTES), CRYPTO_ENTROPY_BYTES);
+
+                secret_keys[i] = hash.scalar();
+
+                // A = (a * G) mod l
+                public_keys[i] = secret_keys[i] * Crypto::G;
+            });
+
+        secure_erase(entropy.data(), entropy.size());
 
         return {public_keys, secret_keys};
     }
@@ -333,4 +979,29 @@ namespace Crypto
         // A = [P - (Ds * G)] mod l
         return public_ephemeral - (scalar * Crypto::G);
     }
+
+    std::vector<crypto_public_key_t> underive_public_keys(
+        const crypto_derivation_t &derivation,
+        const std::vector<uint64_t> &output_indexes,
+        const std::vector<crypto_public_key_t> &public_ephemerals)
+    {
+        if (output_indexes.size() != public_ephemerals.size())
+        {
+            throw std::range_error("output indexes and public ephemerals must be of the same size");
+        }
+
+        const auto scalars = derivation_to_scalar(derivation, output_indexes);
+
+        std::vector<crypto_public_key_t> result;
+
+        result.reserve(public_ephemerals.size());
+
+        for (size_t i = 0; i < public_ephemerals.size(); ++i)
+        {
+            // A = [P - (Ds * G)] mod l
+            result.push_back(public_ephemerals[i] - (scalars[i] * Crypto::G));
+        }
+
+        return result;
+    }
 } // namespace Crypto
@@ -0,0 +1,96 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <crypto_init.h>
+#include <crypto_parallel.h>
+#ifndef CRYPTO_VERIFICATION_ONLY
+#include <encoding/mnemonics.h>
+#endif
+#include <functional>
+#include <helpers/fixed_base_table_t.h>
+#include <proofs/bulletproofs.h>
+#include <proofs/bulletproofsplus.h>
+
+namespace Crypto
+{
+    void init(const init_options_t &options)
+    {
+        std::vector<std::function<void()>> tasks;
+
+        // the fixed-base window tables for the generator points
+        tasks.emplace_back(
+            []()
+            {
+                G_table();
+
+                H_table();
+
+                U_table();
+            });
+
+        tasks.emplace_back([&options]() { RangeProofs::Bulletproofs::preload_generators(options.generator_count); });
+
+        tasks.emplace_back(
+            [&options]() { RangeProofs::BulletproofsPlus::preload_generators(options.generator_count); });
+
+#ifndef CRYPTO_VERIFICATION_ONLY
+        if (options.include_wordlists)
+        {
+            tasks.emplace_back(
+                []()
+                {
+                    for (const auto &language : Mnemonics::languages())
+                    {
+                        Mnemonics::word_list_trimmed(language);
+                    }
+                });
+        }
+#endif
+
+        if (options.parallel)
+        {
+            Crypto::Parallel::parallel_for(0, tasks.size(), [&tasks](size_t i) { tasks[i](); });
+        }
+        else
+        {
+            for (const auto &task : tasks)
+            {
+                task();
+            }
+        }
+    }
+
+    void preload_verification_tables(size_t generator_count)
+    {
+        init_options_t options;
+
+        options.generator_count = generator_count;
+
+        options.include_wordlists = false;
+
+        init(options);
+    }
+} // namespace Crypto
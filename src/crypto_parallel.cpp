@@ -0,0 +1,312 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <crypto_parallel.h>
+#include <mutex>
+#include <thread>
+
+// the worker count requested via set_concurrency (0 selects hardware concurrency)
+static std::atomic<size_t> requested_threads {0};
+
+// set while the calling thread is itself a pool worker (nested calls run inline)
+static thread_local bool inside_pool_worker = false;
+
+namespace
+{
+    /**
+     * The lazily-created library-wide pool. One parallel operation runs at a
+     * time; its indexes are claimed dynamically from a shared cursor by the
+     * workers and the submitting thread alike, which balances uneven work
+     * items across the pool without per-worker queues
+     */
+    class worker_pool_t
+    {
+      public:
+        static worker_pool_t &instance()
+        {
+            static worker_pool_t pool;
+
+            return pool;
+        }
+
+        size_t size() const
+        {
+            return workers.size() + 1;
+        }
+
+        [[nodiscard]] bool has_workers() const
+        {
+            return !workers.empty();
+        }
+
+        void enqueue(std::function<void()> task)
+        {
+            {
+                std::scoped_lock lock(state_mutex);
+
+                tasks.push_back(std::move(task));
+            }
+
+            wake.notify_one();
+        }
+
+        void run(size_t begin, size_t end, const std::function<void(size_t)> &body)
+        {
+            // one operation owns the pool at a time; others queue up here
+            std::scoped_lock operation_lock(operation_mutex);
+
+            {
+                std::scoped_lock lock(state_mutex);
+
+                job_body = &body;
+
+                job_end = end;
+
+                job_completed = begin;
+
+                /**
+                 * The cursor is the gate that late workers from a previous job
+                 * spin out on, so it is reset to the live range last and parked
+                 * back at the sentinel once the job has drained
+                 */
+                job_cursor = begin;
+
+                generation++;
+            }
+
+            wake.notify_all();
+
+            // the submitting thread works the job alongside the pool
+            work_job();
+
+            std::unique_lock lock(state_mutex);
+
+            done.wait(lock, [this]() { return job_completed == job_end; });
+
+            job_cursor = CURSOR_PARKED;
+
+            job_body = nullptr;
+        }
+
+      private:
+        worker_pool_t()
+        {
+            auto count = requested_threads.load();
+
+            if (count == 0)
+            {
+                count = std::max<size_t>(1, std::thread::hardware_concurrency());
+            }
+
+            // the submitting thread always participates so one fewer worker is needed
+            for (size_t i = 0; i + 1 < count; ++i)
+            {
+                workers.emplace_back([this]() { worker_loop(); });
+            }
+        }
+
+        ~worker_pool_t()
+        {
+            {
+                std::scoped_lock lock(state_mutex);
+
+                stopping = true;
+
+                generation++;
+            }
+
+            wake.notify_all();
+
+            for (auto &worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        void worker_loop()
+        {
+            inside_pool_worker = true;
+
+            uint64_t seen_generation = 0;
+
+            while (true)
+            {
+                std::function<void()> task;
+
+                {
+                    std::unique_lock lock(state_mutex);
+
+                    wake.wait(
+                        lock,
+                        [this, seen_generation]()
+                        { return stopping || generation != seen_generation || !tasks.empty(); });
+
+                    if (stopping)
+                    {
+                        return;
+                    }
+
+                    // submitted tasks take priority over joining a loop job
+                    if (!tasks.empty())
+                    {
+                        task = std::move(tasks.front());
+
+                        tasks.pop_front();
+                    }
+                    else
+                    {
+                        seen_generation = generation;
+                    }
+                }
+
+                if (task)
+                {
+                    task();
+
+                    continue;
+                }
+
+                work_job();
+            }
+        }
+
+        void work_job()
+        {
+            while (true)
+            {
+                const auto index = job_cursor.fetch_add(1);
+
+                if (index >= job_end)
+                {
+                    break;
+                }
+
+                (*job_body.load())(index);
+
+                if (job_completed.fetch_add(1) + 1 == job_end)
+                {
+                    // taking the lock prevents the submitter missing the wakeup
+                    std::scoped_lock lock(state_mutex);
+
+                    done.notify_all();
+                }
+            }
+        }
+
+        // parks the cursor between jobs so that late workers claim nothing
+        static const size_t CURSOR_PARKED = SIZE_MAX / 2;
+
+        std::vector<std::thread> workers;
+
+        std::deque<std::function<void()>> tasks;
+
+        std::mutex operation_mutex, state_mutex;
+
+        std::condition_variable wake, done;
+
+        std::atomic<size_t> job_cursor {CURSOR_PARKED}, job_completed {0}, job_end {0};
+
+        std::atomic<const std::function<void(size_t)> *> job_body {nullptr};
+
+        uint64_t generation = 0;
+
+        bool stopping = false;
+    };
+} // namespace
+
+namespace Crypto::Parallel
+{
+    size_t concurrency()
+    {
+        return worker_pool_t::instance().size();
+    }
+
+    void set_concurrency(size_t threads)
+    {
+        requested_threads = threads;
+    }
+
+    void parallel_for(size_t begin, size_t end, const std::function<void(size_t)> &body)
+    {
+        if (end <= begin)
+        {
+            return;
+        }
+
+        // tiny ranges and nested calls from pool workers run inline
+        if (end - begin == 1 || inside_pool_worker)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                body(i);
+            }
+
+            return;
+        }
+
+        worker_pool_t::instance().run(begin, end, body);
+    }
+
+    void submit(std::function<void()> task)
+    {
+        /**
+         * A task submitted from inside a pool worker runs inline: the worker
+         * cannot be both executing this function and draining the queue, and
+         * running inline preserves forward progress under a saturated pool.
+         * The same applies on single-threaded configurations -- with no
+         * workers there is nothing to drain the queue, so enqueueing would
+         * leave the task (and any future waiting on it) stranded forever
+         */
+        if (inside_pool_worker || !worker_pool_t::instance().has_workers())
+        {
+            task();
+
+            return;
+        }
+
+        worker_pool_t::instance().enqueue(std::move(task));
+    }
+
+    void parallel_invoke(const std::function<void()> &first, const std::function<void()> &second)
+    {
+        const std::function<void(size_t)> body = [&first, &second](size_t index)
+        {
+            if (index == 0)
+            {
+                first();
+            }
+            else
+            {
+                second();
+            }
+        };
+
+        parallel_for(0, 2, body);
+    }
+} // namespace Crypto::Parallel
@@ -0,0 +1,115 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <crypto_constants.h>
+#include <crypto_parallel.h>
+#include <crypto_scanner.h>
+
+namespace Crypto::Scanner
+{
+    std::vector<match_t> scan(
+        const crypto_public_key_t &public_spend_key,
+        const crypto_scalar_t &private_view_key,
+        const std::vector<output_record_t> &records)
+    {
+        SCALAR_NZ_OR_THROW(private_view_key);
+
+        if (records.empty())
+        {
+            return {};
+        }
+
+        /**
+         * The records are partitioned into contiguous chunks so that each
+         * worker keeps the expensive per-transaction derivation cached while
+         * it walks its run of adjacent outputs
+         */
+        const auto chunk_count = std::min(Crypto::Parallel::concurrency(), records.size());
+
+        const auto chunk_size = (records.size() + chunk_count - 1) / chunk_count;
+
+        std::vector<std::vector<match_t>> chunk_matches(chunk_count);
+
+        Crypto::Parallel::parallel_for(
+            0,
+            chunk_count,
+            [&](size_t chunk)
+            {
+                const auto start = chunk * chunk_size;
+
+                const auto end = std::min(start + chunk_size, records.size());
+
+                crypto_public_key_t cached_tx_key;
+
+                crypto_derivation_t derivation;
+
+                bool have_derivation = false;
+
+                auto writer = Serialization::serializer_t();
+
+                for (size_t i = start; i < end; ++i)
+                {
+                    const auto &record = records[i];
+
+                    // outputs of one transaction share their derivation
+                    if (!have_derivation || record.tx_public_key != cached_tx_key)
+                    {
+                        derivation = Crypto::generate_key_derivation(record.tx_public_key, private_view_key);
+
+                        cached_tx_key = record.tx_public_key;
+
+                        have_derivation = true;
+                    }
+
+                    // Ds = H(D || output_index) mod l
+                    writer.reset();
+
+                    writer.pod(DERIVATION_DOMAIN_0);
+
+                    writer.pod(derivation);
+
+                    writer.uint64(record.output_index);
+
+                    const auto derivation_scalar = crypto_hash_t::sha3(writer).scalar();
+
+                    // B = [P - (Ds * G)] mod l
+                    if ((record.output_key - (derivation_scalar * Crypto::G)) == public_spend_key)
+                    {
+                        chunk_matches[chunk].push_back({i, derivation_scalar});
+                    }
+                }
+            });
+
+        std::vector<match_t> results;
+
+        for (const auto &matches : chunk_matches)
+        {
+            results.insert(results.end(), matches.begin(), matches.end());
+        }
+
+        return results;
+    }
+} // namespace Crypto::Scanner
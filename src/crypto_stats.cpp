@@ -0,0 +1,81 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <atomic>
+#include <crypto_stats.h>
+#include <mutex>
+
+static thread_local Crypto::Stats::counters_t counters;
+
+static std::mutex timing_mutex;
+
+static Crypto::Stats::timing_callback_t timing_callback;
+
+static std::atomic<bool> timing_registered {false};
+
+namespace Crypto::Stats
+{
+    counters_t snapshot()
+    {
+        return counters;
+    }
+
+    void reset()
+    {
+        counters = counters_t();
+    }
+
+    void set_timing_callback(timing_callback_t callback)
+    {
+        std::scoped_lock lock(timing_mutex);
+
+        timing_callback = std::move(callback);
+
+        timing_registered = bool(timing_callback);
+    }
+
+    bool timing_enabled()
+    {
+        return timing_registered;
+    }
+
+    void report_timing(const char *operation, uint64_t nanoseconds)
+    {
+        std::scoped_lock lock(timing_mutex);
+
+        if (timing_callback)
+        {
+            timing_callback(operation, nanoseconds);
+        }
+    }
+
+#ifdef ENABLE_CRYPTO_STATS
+    counters_t &thread_counters()
+    {
+        return counters;
+    }
+#endif
+} // namespace Crypto::Stats
@@ -0,0 +1,476 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * Standalone benchmark harness covering prove/verify of every proof and
+ * signature scheme across ring and batch size sweeps, emitting one
+ * machine-readable JSON document on stdout with per-case median and p99
+ * latencies so releases can be gated on regressions:
+ *
+ *     cryptobench [iterations]
+ *
+ * A captured workload trace replays end to end through the block verifier
+ * with:
+ *
+ *     cryptobench --replay <trace_file>
+ *
+ * The trace format is one operation mix per line --
+ *     clsag|borromean|triptych <ring_size> <count>
+ *     bulletproof|bulletproofplus <outputs> <count>
+ * -- which is enough to capture anonymized mempool shapes (scheme mix, ring
+ * sizes, and batch shapes) without any transaction content
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <crypto.h>
+#include <crypto_block_verifier.h>
+#include <fstream>
+#include <helpers/random_bytes.h>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+static size_t benchmark_iterations = 25;
+
+/**
+ * Runs the case the configured number of times and emits its JSON record
+ * @param name
+ * @param size the swept dimension (ring size, output count, or batch size)
+ * @param body
+ */
+static void benchmark_case(const std::string &name, size_t size, const std::function<void()> &body)
+{
+    static bool first_case = true;
+
+    std::vector<uint64_t> samples;
+
+    samples.reserve(benchmark_iterations);
+
+    for (size_t i = 0; i < benchmark_iterations; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        body();
+
+        const auto finish = std::chrono::steady_clock::now();
+
+        samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count());
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    const auto median = samples[samples.size() / 2];
+
+    const auto p99 = samples[std::min(samples.size() - 1, (samples.size() * 99) / 100)];
+
+    uint64_t total = 0;
+
+    for (const auto &sample : samples)
+    {
+        total += sample;
+    }
+
+    if (!first_case)
+    {
+        std::cout << "," << std::endl;
+    }
+
+    first_case = false;
+
+    std::cout << "    {\"name\": \"" << name << "\", \"size\": " << size
+              << ", \"iterations\": " << benchmark_iterations << ", \"median_ns\": " << median
+              << ", \"p99_ns\": " << p99 << ", \"mean_ns\": " << (total / samples.size()) << "}";
+}
+
+static void benchmark_range_proofs()
+{
+    for (const size_t outputs : {1, 2, 4, 8, 16})
+    {
+        std::vector<uint64_t> amounts(outputs, 1000000);
+
+        const auto blinding_factors = crypto_scalar_t::random(outputs);
+
+        benchmark_case(
+            "bulletproofs::prove",
+            outputs,
+            [&]() { Crypto::RangeProofs::Bulletproofs::prove(amounts, blinding_factors); });
+
+        const auto [proof, commitments] = Crypto::RangeProofs::Bulletproofs::prove(amounts, blinding_factors);
+
+        benchmark_case(
+            "bulletproofs::verify", outputs, [&]() { Crypto::RangeProofs::Bulletproofs::verify(proof, commitments); });
+
+        benchmark_case(
+            "bulletproofsplus::prove",
+            outputs,
+            [&]() { Crypto::RangeProofs::BulletproofsPlus::prove(amounts, blinding_factors); });
+
+        const auto [plus_proof, plus_commitments] =
+            Crypto::RangeProofs::BulletproofsPlus::prove(amounts, blinding_factors);
+
+        benchmark_case(
+            "bulletproofsplus::verify",
+            outputs,
+            [&]() { Crypto::RangeProofs::BulletproofsPlus::verify(plus_proof, plus_commitments); });
+    }
+
+    // batched verification sweeps
+    for (const size_t batch : {2, 8, 32})
+    {
+        const std::vector<uint64_t> amounts(2, 1000000);
+
+        const auto blinding_factors = crypto_scalar_t::random(2);
+
+        const auto [proof, commitments] = Crypto::RangeProofs::BulletproofsPlus::prove(amounts, blinding_factors);
+
+        const std::vector<crypto_bulletproof_plus_t> proofs(batch, proof);
+
+        const std::vector<std::vector<crypto_pedersen_commitment_t>> commitment_sets(batch, commitments);
+
+        benchmark_case(
+            "bulletproofsplus::verify_batch",
+            batch,
+            [&]() { Crypto::RangeProofs::BulletproofsPlus::verify(proofs, commitment_sets); });
+    }
+}
+
+static void benchmark_ring_signatures()
+{
+    const auto message_digest = crypto_hash_t::random();
+
+    for (const size_t ring_size : {4, 16, 64})
+    {
+        auto [public_keys, secret_keys] = Crypto::generate_keys_m(ring_size);
+
+        const auto &secret_key = secret_keys[0];
+
+        const auto public_ephemeral = public_keys[0];
+
+        const auto key_image = Crypto::generate_key_image(public_ephemeral, secret_key);
+
+        // CLSAG
+        {
+            benchmark_case(
+                "clsag::generate",
+                ring_size,
+                [&]() { Crypto::RingSignature::CLSAG::generate_ring_signature(message_digest, secret_key, public_keys); });
+
+            const auto [success, signature] =
+                Crypto::RingSignature::CLSAG::generate_ring_signature(message_digest, secret_key, public_keys);
+
+            if (success)
+            {
+                benchmark_case(
+                    "clsag::check",
+                    ring_size,
+                    [&]()
+                    { Crypto::RingSignature::CLSAG::check_ring_signature(message_digest, key_image, public_keys, signature); });
+            }
+        }
+
+        // Borromean
+        {
+            benchmark_case(
+                "borromean::generate",
+                ring_size,
+                [&]()
+                { Crypto::RingSignature::Borromean::generate_ring_signature(message_digest, secret_key, public_keys); });
+
+            const auto [success, signature] =
+                Crypto::RingSignature::Borromean::generate_ring_signature(message_digest, secret_key, public_keys);
+
+            if (success)
+            {
+                benchmark_case(
+                    "borromean::check",
+                    ring_size,
+                    [&]() {
+                        Crypto::RingSignature::Borromean::check_ring_signature(
+                            message_digest, key_image, public_keys, signature);
+                    });
+            }
+        }
+
+        // Triptych requires commitment material alongside the ring
+        {
+            const auto input_blinding = crypto_scalar_t::random();
+
+            const auto pseudo_blinding = crypto_scalar_t::random();
+
+            std::vector<crypto_pedersen_commitment_t> input_commitments(ring_size);
+
+            for (size_t i = 0; i < ring_size; ++i)
+            {
+                input_commitments[i] = Crypto::RingCT::generate_pedersen_commitment(
+                    i == 0 ? input_blinding : crypto_scalar_t::random(), 100);
+            }
+
+            const auto pseudo_commitment = Crypto::RingCT::generate_pedersen_commitment(pseudo_blinding, 100);
+
+            benchmark_case(
+                "triptych::generate",
+                ring_size,
+                [&]()
+                {
+                    Crypto::RingSignature::Triptych::generate_ring_signature(
+                        message_digest,
+                        secret_key,
+                        public_keys,
+                        input_blinding,
+                        input_commitments,
+                        pseudo_blinding,
+                        pseudo_commitment);
+                });
+
+            const auto [success, signature] = Crypto::RingSignature::Triptych::generate_ring_signature(
+                message_digest,
+                secret_key,
+                public_keys,
+                input_blinding,
+                input_commitments,
+                pseudo_blinding,
+                pseudo_commitment);
+
+            if (success)
+            {
+                const auto triptych_key_image = Crypto::generate_key_image_v2(secret_key);
+
+                benchmark_case(
+                    "triptych::check",
+                    ring_size,
+                    [&]()
+                    {
+                        Crypto::RingSignature::Triptych::check_ring_signature(
+                            message_digest, triptych_key_image, public_keys, signature, input_commitments);
+                    });
+            }
+        }
+    }
+}
+
+/**
+ * Replays the workload trace by synthesizing proofs and signatures of the
+ * recorded shapes and pushing the whole mix through the block verifier,
+ * reporting end-to-end wall time and throughput
+ * @param trace_path
+ * @return
+ */
+static int replay_trace(const std::string &trace_path)
+{
+    std::ifstream trace(trace_path);
+
+    if (!trace.good())
+    {
+        std::cerr << "Could not open trace: " << trace_path << std::endl;
+
+        return 1;
+    }
+
+    Crypto::block_verifier_t verifier;
+
+    const auto message_digest = crypto_hash_t::random();
+
+    size_t operations = 0;
+
+    std::string line;
+
+    while (std::getline(trace, line))
+    {
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        std::istringstream fields(line);
+
+        std::string scheme;
+
+        size_t size = 0, count = 0;
+
+        if (!(fields >> scheme >> size >> count) || size == 0 || count == 0)
+        {
+            std::cerr << "Malformed trace line: " << line << std::endl;
+
+            return 1;
+        }
+
+        if (scheme == "bulletproof" || scheme == "bulletproofplus")
+        {
+            const std::vector<uint64_t> amounts(size, 1000000);
+
+            const auto blinding_factors = crypto_scalar_t::random(size);
+
+            if (scheme == "bulletproof")
+            {
+                const auto [proof, commitments] = Crypto::RangeProofs::Bulletproofs::prove(amounts, blinding_factors);
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    verifier.add_bulletproof(proof, commitments);
+                }
+            }
+            else
+            {
+                const auto [proof, commitments] =
+                    Crypto::RangeProofs::BulletproofsPlus::prove(amounts, blinding_factors);
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    verifier.add_bulletproof_plus(proof, commitments);
+                }
+            }
+        }
+        else if (scheme == "clsag" || scheme == "borromean" || scheme == "triptych")
+        {
+            auto [public_keys, secret_keys] = Crypto::generate_keys_m(size);
+
+            const auto &secret_key = secret_keys[0];
+
+            const auto key_image = Crypto::generate_key_image(public_keys[0], secret_key);
+
+            if (scheme == "clsag")
+            {
+                const auto [success, signature] =
+                    Crypto::RingSignature::CLSAG::generate_ring_signature(message_digest, secret_key, public_keys);
+
+                if (!success)
+                {
+                    return 1;
+                }
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    verifier.add_clsag(message_digest, key_image, public_keys, signature);
+                }
+            }
+            else if (scheme == "borromean")
+            {
+                const auto [success, signature] =
+                    Crypto::RingSignature::Borromean::generate_ring_signature(message_digest, secret_key, public_keys);
+
+                if (!success)
+                {
+                    return 1;
+                }
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    verifier.add_borromean(message_digest, key_image, public_keys, signature);
+                }
+            }
+            else
+            {
+                const auto input_blinding = crypto_scalar_t::random(), pseudo_blinding = crypto_scalar_t::random();
+
+                std::vector<crypto_pedersen_commitment_t> input_commitments(size);
+
+                for (size_t i = 0; i < size; ++i)
+                {
+                    input_commitments[i] = Crypto::RingCT::generate_pedersen_commitment(
+                        i == 0 ? input_blinding : crypto_scalar_t::random(), 100);
+                }
+
+                const auto pseudo_commitment = Crypto::RingCT::generate_pedersen_commitment(pseudo_blinding, 100);
+
+                const auto [success, signature] = Crypto::RingSignature::Triptych::generate_ring_signature(
+                    message_digest,
+                    secret_key,
+                    public_keys,
+                    input_blinding,
+                    input_commitments,
+                    pseudo_blinding,
+                    pseudo_commitment);
+
+                if (!success)
+                {
+                    return 1;
+                }
+
+                const auto triptych_key_image = Crypto::generate_key_image_v2(secret_key);
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    verifier.add_triptych(message_digest, triptych_key_image, public_keys, signature, input_commitments);
+                }
+            }
+        }
+        else
+        {
+            std::cerr << "Unknown scheme in trace: " << scheme << std::endl;
+
+            return 1;
+        }
+
+        operations += count;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    const auto [verdict, merkle_root] = verifier.verify();
+
+    const auto finish = std::chrono::steady_clock::now();
+
+    const auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+
+    std::cout << "{\"replay\": {\"trace\": \"" << trace_path << "\", \"operations\": " << operations
+              << ", \"verdict\": " << (verdict ? "true" : "false") << ", \"elapsed_ns\": " << elapsed_ns
+              << ", \"operations_per_second\": " << (operations * 1000000000.0 / double(elapsed_ns)) << "}}"
+              << std::endl;
+
+    return verdict ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    /**
+     * Benchmark key material generates deterministically so that runs are
+     * reproducible and regressions below the noise floor stay visible; the
+     * deterministic stream is strictly a test/benchmark facility
+     */
+    random_bytes_seed_deterministic(20090103);
+
+    if (argc > 2 && std::string(argv[1]) == "--replay")
+    {
+        return replay_trace(argv[2]);
+    }
+
+    if (argc > 1)
+    {
+        benchmark_iterations = std::max(1, std::atoi(argv[1]));
+    }
+
+    std::cout << "{" << std::endl << "  \"results\": [" << std::endl;
+
+    benchmark_range_proofs();
+
+    benchmark_ring_signatures();
+
+    std::cout << std::endl << "  ]" << std::endl << "}" << std::endl;
+
+    return 0;
+}
@@ -1421,6 +1421,550 @@ int main()
         }
     }
 
+    // CLSAG Batch Verification
+    {
+        std::cout << std::endl << std::endl << "CLSAG Batch Verification" << std::endl;
+
+        // the rings overlap completely which is the shape the batch cache targets
+        auto public_keys = crypto_point_t::random(RING_SIZE);
+
+        public_keys[RING_SIZE / 2] = public_ephemeral;
+
+        std::vector<crypto_hash_t> messages;
+
+        std::vector<crypto_key_image_t> key_images;
+
+        std::vector<std::vector<crypto_public_key_t>> rings;
+
+        std::vector<crypto_clsag_signature_t> signatures;
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            const auto message = crypto_hash_t::random();
+
+            const auto [gen_success, signature] =
+                Crypto::RingSignature::CLSAG::generate_ring_signature(message, secret_ephemeral, public_keys);
+
+            if (!gen_success)
+            {
+                std::cout << "CLSAG::check_ring_signatures[generate]: Failed!" << std::endl;
+
+                return 1;
+            }
+
+            // every batch member must also pass the single-signature verifier
+            if (!Crypto::RingSignature::CLSAG::check_ring_signature(message, key_image, public_keys, signature))
+            {
+                std::cout << "CLSAG::check_ring_signatures[single cross-check]: Failed!" << std::endl;
+
+                return 1;
+            }
+
+            messages.push_back(message);
+
+            key_images.push_back(key_image);
+
+            rings.push_back(public_keys);
+
+            signatures.push_back(signature);
+        }
+
+        if (!Crypto::RingSignature::CLSAG::check_ring_signatures(messages, key_images, rings, signatures))
+        {
+            std::cout << "CLSAG::check_ring_signatures: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        std::cout << "CLSAG::check_ring_signatures: Passed!" << std::endl;
+
+        // an empty batch is vacuously valid
+        if (!Crypto::RingSignature::CLSAG::check_ring_signatures({}, {}, {}, {}))
+        {
+            std::cout << "CLSAG::check_ring_signatures[empty]: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        std::cout << "CLSAG::check_ring_signatures[empty]: Passed!" << std::endl;
+
+        // tampering any one entry must fail the whole batch
+        std::swap(messages[0], messages[1]);
+
+        if (Crypto::RingSignature::CLSAG::check_ring_signatures(messages, key_images, rings, signatures))
+        {
+            std::cout << "CLSAG::check_ring_signatures[reject]: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        std::cout << "CLSAG::check_ring_signatures[reject]: Passed!" << std::endl;
+    }
+
+    // Borromean Batch Verification
+    {
+        std::cout << std::endl << std::endl << "Borromean Batch Verification" << std::endl;
+
+        auto public_keys = crypto_point_t::random(RING_SIZE);
+
+        public_keys[RING_SIZE / 2] = public_ephemeral;
+
+        std::vector<crypto_hash_t> messages;
+
+        std::vector<crypto_key_image_t> key_images;
+
+        std::vector<std::vector<crypto_public_key_t>> rings;
+
+        std::vector<crypto_borromean_signature_t> signatures;
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            const auto message = crypto_hash_t::random();
+
+            const auto [gen_success, signature] =
+                Crypto::RingSignature::Borromean::generate_ring_signature(message, secret_ephemeral, public_keys);
+
+            if (!gen_success)
+            {
+                std::cout << "Borromean::check_ring_signatures[generate]: Failed!" << std::endl;
+
+                return 1;
+            }
+
+            // every batch member must also pass the single-signature verifier
+            if (!Crypto::RingSignature::Borromean::check_ring_signature(message, key_image, public_keys, signature))
+            {
+                std::cout << "Borromean::check_ring_signatures[single cross-check]: Failed!" << std::endl;
+
+                return 1;
+            }
+
+            messages.push_back(message);
+
+            key_images.push_back(key_image);
+
+            rings.push_back(public_keys);
+
+            signatures.push_back(signature);
+        }
+
+        if (!Crypto::RingSignature::Borromean::check_ring_signatures(messages, key_images, rings, signatures))
+        {
+            std::cout << "Borromean::check_ring_signatures: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        std::cout << "Borromean::check_ring_signatures: Passed!" << std::endl;
+
+        // an empty batch is vacuously valid
+        if (!Crypto::RingSignature::Borromean::check_ring_signatures({}, {}, {}, {}))
+        {
+            std::cout << "Borromean::check_ring_signatures[empty]: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        std::cout << "Borromean::check_ring_signatures[empty]: Passed!" << std::endl;
+
+        // tampering any one entry must fail the whole batch
+        std::swap(messages[0], messages[1]);
+
+        if (Crypto::RingSignature::Borromean::check_ring_signatures(messages, key_images, rings, signatures))
+        {
+            std::cout << "Borromean::check_ring_signatures[reject]: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        std::cout << "Borromean::check_ring_signatures[reject]: Passed!" << std::endl;
+    }
+
+    // Triptych Batch Verification
+    {
+        std::cout << std::endl << std::endl << "Triptych Batch Verification" << std::endl;
+
+        const auto image = Crypto::generate_key_image_v2(secret_ephemeral);
+
+        std::vector<crypto_hash_t> messages;
+
+        std::vector<crypto_key_image_t> key_images;
+
+        std::vector<std::vector<crypto_public_key_t>> rings;
+
+        std::vector<crypto_triptych_signature_t> signatures;
+
+        std::vector<std::vector<crypto_pedersen_commitment_t>> commitments;
+
+        for (size_t i = 0; i < 2; ++i)
+        {
+            auto public_keys = crypto_point_t::random(RING_SIZE);
+
+            public_keys[RING_SIZE / 2] = public_ephemeral;
+
+            const auto input_blinding = crypto_scalar_t::random();
+
+            const auto input_commitment = Crypto::RingCT::generate_pedersen_commitment(input_blinding, 100);
+
+            std::vector<crypto_pedersen_commitment_t> public_commitments = crypto_point_t::random(RING_SIZE);
+
+            public_commitments[RING_SIZE / 2] = input_commitment;
+
+            const auto [ps_blindings, ps_commitments] =
+                Crypto::RingCT::generate_pseudo_commitments({100}, crypto_scalar_t::random(1));
+
+            const auto message = crypto_hash_t::random();
+
+            const auto [gen_success, signature] = Crypto::RingSignature::Triptych::generate_ring_signature(
+                message,
+                secret_ephemeral,
+                public_keys,
+                input_blinding,
+                public_commitments,
+                ps_blindings[0],
+                ps_commitments[0]);
+
+            if (!gen_success)
+            {
+                std::cout << "Triptych::check_ring_signatures[generate]: Failed!" << std::endl;
+
+                return 1;
+            }
+
+            // every batch member must also pass the single-signature verifier
+            if (!Crypto::RingSignature::Triptych::check_ring_signature(
+                    message, image, public_keys, signature, public_commitments))
+            {
+                std::cout << "Triptych::check_ring_signatures[single cross-check]: Failed!" << std::endl;
+
+                return 1;
+            }
+
+            messages.push_back(message);
+
+            key_images.push_back(image);
+
+            rings.push_back(public_keys);
+
+            signatures.push_back(signature);
+
+            commitments.push_back(public_commitments);
+        }
+
+        if (!Crypto::RingSignature::Triptych::check_ring_signatures(messages, key_images, rings, signatures, commitments))
+        {
+            std::cout << "Triptych::check_ring_signatures: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        std::cout << "Triptych::check_ring_signatures: Passed!" << std::endl;
+
+        // an empty batch is vacuously valid
+        if (!Crypto::RingSignature::Triptych::check_ring_signatures({}, {}, {}, {}, {}))
+        {
+            std::cout << "Triptych::check_ring_signatures[empty]: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        std::cout << "Triptych::check_ring_signatures[empty]: Passed!" << std::endl;
+
+        // tampering any one entry must fail the whole batch
+        std::swap(messages[0], messages[1]);
+
+        if (Crypto::RingSignature::Triptych::check_ring_signatures(messages, key_images, rings, signatures, commitments))
+        {
+            std::cout << "Triptych::check_ring_signatures[reject]: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        std::cout << "Triptych::check_ring_signatures[reject]: Passed!" << std::endl;
+    }
+
+    // RFC8032 Batch Verification
+    {
+        std::cout << std::endl << std::endl << "RFC8032 Batch Verification" << std::endl;
+
+        std::vector<std::vector<unsigned char>> messages;
+
+        std::vector<crypto_public_key_t> public_keys;
+
+        std::vector<crypto_signature_t> signatures;
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            const auto message = crypto_hash_t::random().serialize();
+
+            const auto signature = Crypto::RFC8032::generate_signature(message, secret_key);
+
+            // every batch member must also pass the single-signature verifier
+            if (!Crypto::RFC8032::check_signature(message, public_key, signature))
+            {
+                std::cout << "RFC8032::verify_batch[single cross-check]: Failed!" << std::endl;
+
+                return 1;
+            }
+
+            messages.push_back(message);
+
+            public_keys.push_back(public_key);
+
+            signatures.push_back(signature);
+        }
+
+        if (!Crypto::RFC8032::verify_batch(messages, public_keys, signatures))
+        {
+            std::cout << "RFC8032::verify_batch: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        std::cout << "RFC8032::verify_batch: Passed!" << std::endl;
+
+        // an empty batch is vacuously valid
+        if (!Crypto::RFC8032::verify_batch({}, {}, {}))
+        {
+            std::cout << "RFC8032::verify_batch[empty]: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        std::cout << "RFC8032::verify_batch[empty]: Passed!" << std::endl;
+
+        // tampering any one entry must fail the whole batch
+        std::swap(messages[0], messages[1]);
+
+        if (Crypto::RFC8032::verify_batch(messages, public_keys, signatures))
+        {
+            std::cout << "RFC8032::verify_batch[reject]: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        std::cout << "RFC8032::verify_batch[reject]: Passed!" << std::endl;
+    }
+
+    // Incremental Merkle Tree
+    {
+        std::cout << std::endl << std::endl << "Incremental Merkle Tree" << std::endl;
+
+        const auto leaves = crypto_hash_t::random(8);
+
+        incremental_merkle_tree_t tree;
+
+        for (const auto &leaf : leaves)
+        {
+            tree.append(leaf);
+        }
+
+        if (tree.size() != leaves.size() || tree.depth() != 3)
+        {
+            std::cout << "incremental_merkle_tree_t[shape]: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        // appending one at a time and constructing from the full set must agree
+        if (tree.root() != incremental_merkle_tree_t(leaves).root())
+        {
+            std::cout << "incremental_merkle_tree_t[root]: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        std::cout << "incremental_merkle_tree_t[root]: Passed!" << std::endl;
+
+        // the extracted branch must fold back to the root via the existing method
+        const auto branch = tree.branch();
+
+        if (Crypto::Merkle::root_hash_from_branch(branch, tree.depth(), leaves[0], 0) != tree.root())
+        {
+            std::cout << "incremental_merkle_tree_t[branch]: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        std::cout << "incremental_merkle_tree_t[branch]: Passed!" << std::endl;
+    }
+
+    // Wire Codec
+    {
+        std::cout << std::endl << std::endl << "Wire Codec" << std::endl;
+
+        auto public_keys = crypto_point_t::random(RING_SIZE);
+
+        public_keys[RING_SIZE / 2] = public_ephemeral;
+
+        const auto [gen_success, signature] =
+            Crypto::RingSignature::CLSAG::generate_ring_signature(SHA3_HASH, secret_ephemeral, public_keys);
+
+        if (!gen_success)
+        {
+            std::cout << "Wire codec[generate]: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        // signature round trip through the compact wire format
+        {
+            const auto blob = signature.to_bytes();
+
+            crypto_clsag_signature_t decoded;
+
+            decoded.from_bytes(blob.data(), blob.size());
+
+            if (decoded.hash() != signature.hash())
+            {
+                std::cout << "Wire codec[CLSAG round trip]: Failed!" << std::endl;
+
+                return 1;
+            }
+
+            // truncated wire data must be rejected through the documented path
+            bool rejected = false;
+
+            try
+            {
+                crypto_clsag_signature_t truncated;
+
+                truncated.from_bytes(blob.data(), blob.size() - 5);
+            }
+            catch (const std::invalid_argument &)
+            {
+                rejected = true;
+            }
+
+            if (!rejected)
+            {
+                std::cout << "Wire codec[CLSAG truncation]: Failed!" << std::endl;
+
+                return 1;
+            }
+
+            std::cout << "Wire codec[CLSAG]: Passed!" << std::endl;
+        }
+
+        // range proof round trip through the compact wire format
+        {
+            const auto [proof, commitments] =
+                Crypto::RangeProofs::BulletproofsPlus::prove({100}, {crypto_scalar_t::random()});
+
+            const auto blob = proof.to_bytes();
+
+            crypto_bulletproof_plus_t decoded;
+
+            decoded.from_bytes(blob.data(), blob.size());
+
+            if (decoded.hash() != proof.hash())
+            {
+                std::cout << "Wire codec[Bulletproof+ round trip]: Failed!" << std::endl;
+
+                return 1;
+            }
+
+            std::cout << "Wire codec[Bulletproof+]: Passed!" << std::endl;
+        }
+
+        // pod vector round trip plus hostile-count rejection
+        {
+            const auto hashes = crypto_hash_vector_t(crypto_hash_t::random(16));
+
+            const auto blob = hashes.to_bytes();
+
+            crypto_hash_vector_t decoded;
+
+            decoded.from_bytes(blob.data(), blob.size());
+
+            if (decoded.container != hashes.container)
+            {
+                std::cout << "Wire codec[hash vector round trip]: Failed!" << std::endl;
+
+                return 1;
+            }
+
+            bool rejected = false;
+
+            try
+            {
+                // a varint count far beyond the buffer must be rejected, not allocated
+                const unsigned char hostile[] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f};
+
+                crypto_hash_vector_t truncated;
+
+                truncated.from_bytes(hostile, sizeof(hostile));
+            }
+            catch (const std::invalid_argument &)
+            {
+                rejected = true;
+            }
+
+            if (!rejected)
+            {
+                std::cout << "Wire codec[hostile count]: Failed!" << std::endl;
+
+                return 1;
+            }
+
+            std::cout << "Wire codec[hash vector]: Passed!" << std::endl;
+        }
+    }
+
+    // Base58 multi-chunk fixed vectors
+    {
+        std::cout << std::endl << std::endl << "Base58 Multi-Chunk Vectors" << std::endl;
+
+        /**
+         * Both fixtures exceed one 32-bit limb and one five-digit chunk so the
+         * chunked codec's carry and leading-zero handling are pinned to known
+         * encodings; the expected strings come from an independent
+         * implementation of the canonical base conversion
+         */
+        std::vector<uint8_t> fixture;
+
+        for (uint8_t byte = 1; byte <= 40; ++byte)
+        {
+            fixture.push_back(byte);
+        }
+
+        if (Crypto::Base58::encode(fixture) != "3uTox6ig7oRwvFGCBiq9eTm9PyYFm7xczABQXhmzw9y83akQuQRaxX")
+        {
+            std::cout << "Crypto::Base58[fixed vector]: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        std::vector<uint8_t> zero_fixture = {0x00, 0x00};
+
+        for (uint8_t byte = 1; byte <= 38; ++byte)
+        {
+            zero_fixture.push_back(byte);
+        }
+
+        if (Crypto::Base58::encode(zero_fixture) != "119eYPYgcpVXL9SuvDeWJ5LyEMqMFgtX34FSjfnYw79uBp5soUPYq")
+        {
+            std::cout << "Crypto::Base58[leading zero vector]: Failed!" << std::endl;
+
+            return 1;
+        }
+
+        // and both must decode back to the exact input bytes
+        for (const auto &expected : {fixture, zero_fixture})
+        {
+            auto [success, reader] = Crypto::Base58::decode(Crypto::Base58::encode(expected));
+
+            if (!success || reader.unread_data() != expected)
+            {
+                std::cout << "Crypto::Base58[fixed vector decode]: Failed!" << std::endl;
+
+                return 1;
+            }
+        }
+
+        std::cout << "Crypto::Base58[multi-chunk vectors]: Passed!" << std::endl;
+    }
+
     // Benchmarks
     {
         std::cout << std::endl << std::endl << std::endl;
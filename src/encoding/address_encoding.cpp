@@ -24,6 +24,7 @@
 // STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <crypto_parallel.h>
 #include <encoding/address_encoding.h>
 #include <encoding/base58.h>
 #include <encoding/cn_base58.h>
@@ -89,6 +90,42 @@ namespace Crypto::Address
 
             return Crypto::Base58::encode_check(writer);
         }
+
+        std::vector<std::tuple<bool, uint64_t, crypto_public_key_t, crypto_public_key_t>>
+            decode(const std::vector<std::string> &addresses)
+        {
+            std::vector<std::tuple<bool, uint64_t, crypto_public_key_t, crypto_public_key_t>> results(
+                addresses.size());
+
+            Crypto::Parallel::parallel_for(
+                0, addresses.size(), [&](size_t i) { results[i] = decode(addresses[i]); });
+
+            return results;
+        }
+
+        std::vector<std::string> encode(
+            const uint64_t &prefix,
+            const std::vector<std::tuple<crypto_public_key_t, crypto_public_key_t>> &key_pairs)
+        {
+            std::vector<std::string> results(key_pairs.size());
+
+            /**
+             * The per-worker serialization buffer and the thread's cached
+             * hashing state are reused across every address the worker encodes
+             */
+            Crypto::Parallel::parallel_for(
+                0,
+                key_pairs.size(),
+                [&](size_t i)
+                {
+                    const auto &[public_spend, public_view] = key_pairs[i];
+
+                    results[i] = encode(prefix, public_spend, public_view);
+                });
+
+            return results;
+        }
+
     } // namespace Base58
 
     namespace CNBase58
@@ -25,15 +25,18 @@
 // STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
-#include <cassert>
+#include <algorithm>
 #include <crypto_config.h>
 #include <encoding/base58.h>
 #include <types/crypto_hash_t.h>
 
-#define UNUSED(x) (void)(x)
-
 static const char *Base58Characters = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
 
+// 58^5 is the largest power of 58 that fits in 32-bits which keeps the limb math portable
+static const uint64_t BASE58_CHUNK_MOD = 656356768ull;
+
+static const size_t BASE58_CHUNK_DIGITS = 5;
+
 static const int8_t Base58Map[256] = {
     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,  1,  2,  3,  4,  5,  6,  7,  8,
@@ -55,73 +58,92 @@ namespace Crypto::Base58
             return {false, {}};
         }
 
-        const auto *data = input.c_str();
+        static_assert(std::size(Base58Map) == 256, "Base58Map.size() should be 256");
 
         // skip and count leading 1s
-        int zeroes = 0, length = 0;
+        size_t zeroes = 0;
 
-        while (*data == '1')
+        while (zeroes < input.size() && input[zeroes] == '1')
         {
             zeroes++;
-
-            UNUSED(*data++);
         }
 
-        // allocate enough space in big-endian base256 representation
-        int size = int(strlen(data)) * 733 / 1000 + 1; // log(58) / log(256) rounded up
+        /**
+         * The numeric portion is accumulated into 32-bit limbs five digits at a
+         * time (58^5 fits in 32-bits) so that each chunk costs one
+         * multiply-accumulate pass over the limbs instead of one pass per digit
+         */
+        std::vector<uint32_t> limbs;
 
-        std::vector<unsigned char> b256(size);
+        limbs.reserve((input.size() - zeroes) * 733 / 1000 / sizeof(uint32_t) + 1);
 
-        // process the characters
-        static_assert(std::size(Base58Map) == 256, "Base58Map.size() should be 256");
+        size_t offset = zeroes;
 
-        while (*data)
+        while (offset < input.size())
         {
-            // decode base58 characters
-            int carry = Base58Map[(uint8_t)*data];
+            const auto chunk_length = std::min(BASE58_CHUNK_DIGITS, input.size() - offset);
 
-            if (carry == -1)
+            uint64_t chunk_value = 0, chunk_base = 1;
+
+            for (size_t i = 0; i < chunk_length; ++i, ++offset)
             {
-                return {false, {}};
+                const auto digit = Base58Map[(uint8_t)input[offset]];
+
+                if (digit == -1)
+                {
+                    return {false, {}};
+                }
+
+                chunk_value = (chunk_value * 58) + digit;
+
+                chunk_base *= 58;
             }
 
-            int i = 0;
+            // limbs = (limbs * chunk_base) + chunk_value
+            uint64_t carry = chunk_value;
 
-            for (auto it = b256.rbegin(); (carry != 0 || i < length) && (it != b256.rend()); ++it, ++i)
+            for (auto &limb : limbs)
             {
-                carry += 58 * (*it);
+                carry += uint64_t(limb) * chunk_base;
 
-                *it = carry % 256;
+                limb = uint32_t(carry);
 
-                carry /= 256;
+                carry >>= 32;
             }
 
-            assert(carry == 0);
-
-            length = i;
+            while (carry != 0)
+            {
+                limbs.push_back(uint32_t(carry));
 
-            data++;
+                carry >>= 32;
+            }
         }
 
-        if (*data != 0)
+        // unpack the limbs into the minimal big-endian byte representation
+        std::vector<uint8_t> number_bytes;
+
+        number_bytes.reserve(limbs.size() * sizeof(uint32_t));
+
+        for (const auto &limb : limbs)
         {
-            return {false, {}};
+            for (size_t b = 0; b < sizeof(uint32_t); ++b)
+            {
+                number_bytes.push_back(uint8_t(limb >> (8 * b)));
+            }
         }
 
-        // skip leading zeroes in b256
-        auto it = b256.begin() + (size - length);
+        while (!number_bytes.empty() && number_bytes.back() == 0)
+        {
+            number_bytes.pop_back();
+        }
 
-        // copy the result into output vector
         std::vector<uint8_t> result;
 
-        result.reserve(zeroes + (b256.end() - it));
+        result.reserve(zeroes + number_bytes.size());
 
         result.assign(zeroes, 0x00);
 
-        while (it != b256.end())
-        {
-            result.push_back(*(it++));
-        }
+        result.insert(result.end(), number_bytes.rbegin(), number_bytes.rend());
 
         return {true, Serialization::deserializer_t(result)};
     }
@@ -164,68 +186,88 @@ namespace Crypto::Base58
 
     std::string encode(std::vector<uint8_t> input)
     {
-        if (input.empty())
+        return encode(input.data(), input.size());
+    }
+
+    std::string encode(const uint8_t *data, size_t length)
+    {
+        if (length == 0)
         {
             return {};
         }
 
         // skip and count leading zeroes
-        int zeroes = 0, length = 0;
+        size_t zeroes = 0;
 
-        while (!input.empty() && input[0] == 0)
+        while (zeroes < length && data[zeroes] == 0)
         {
-            input = std::vector<uint8_t>(input.begin() + 1, input.end());
-
             zeroes++;
         }
 
-        // allocate enough space in big-endian base58 representation
-        int size = int(input.size()) * 138 / 100 + 1; // log(256) / log(58), rounded up
+        // pack the numeric portion into little-endian 32-bit limbs
+        std::vector<uint32_t> limbs((length - zeroes + 3) / 4, 0);
 
-        std::vector<unsigned char> b58(size);
+        for (size_t i = 0; i < length - zeroes; ++i)
+        {
+            limbs[i / 4] |= uint32_t(data[length - 1 - i]) << (8 * (i % 4));
+        }
 
-        // process the bytes
-        while (!input.empty())
+        while (!limbs.empty() && limbs.back() == 0)
         {
-            int carry = input[0];
+            limbs.pop_back();
+        }
+
+        /**
+         * Each pass divides the whole limb vector by 58^5 in one sweep and the
+         * 64-bit remainder is peeled into five base58 digits, so the quadratic
+         * digit-by-digit long division becomes one division per five digits
+         */
+        std::vector<uint8_t> digits;
 
-            int i = 0;
+        digits.reserve((length - zeroes) * 138 / 100 + 1);
+
+        while (!limbs.empty())
+        {
+            uint64_t remainder = 0;
 
-            // apply "b58 = b58 * 256 + ch"
-            for (auto it = b58.rbegin(); (carry != 0 || i < length) && (it != b58.rend()); it++, i++)
+            for (size_t i = limbs.size(); i-- > 0;)
             {
-                carry += 256 * (*it);
+                remainder = (remainder << 32) | limbs[i];
 
-                *it = carry % 58;
+                limbs[i] = uint32_t(remainder / BASE58_CHUNK_MOD);
 
-                carry /= 58;
+                remainder %= BASE58_CHUNK_MOD;
             }
 
-            assert(carry == 0);
+            while (!limbs.empty() && limbs.back() == 0)
+            {
+                limbs.pop_back();
+            }
 
-            length = i;
+            for (size_t i = 0; i < BASE58_CHUNK_DIGITS; ++i)
+            {
+                digits.push_back(uint8_t(remainder % 58));
 
-            input = std::vector<uint8_t>(input.begin() + 1, input.end());
+                remainder /= 58;
+            }
         }
 
-        // skip leading zeroes in base58 result
-        auto it = b58.begin() + (size - length);
-
-        while (it != b58.end() && *it == 0)
+        // strip the most-significant zero digits left over from the final chunk
+        while (!digits.empty() && digits.back() == 0)
         {
-            it++;
+            digits.pop_back();
         }
 
         // translate the result into a string
         std::string result;
 
-        result.reserve(zeroes + (b58.end() - it));
+        result.reserve(zeroes + digits.size());
 
         result.assign(zeroes, '1');
 
-        while (it != b58.end())
+        for (size_t i = digits.size(); i-- > 0;)
         {
-            result += Base58Characters[*(it++)];
+            result += Base58Characters[digits[i]];
         }
 
         return result;
@@ -238,25 +280,37 @@ namespace Crypto::Base58
 
     std::string encode(const Serialization::serializer_t &writer)
     {
-        return encode(writer.vector());
+        // reads straight out of the serializer storage with no staging copy
+        return encode(writer.data(), writer.size());
     }
 
     std::string encode_check(const std::vector<uint8_t> &input)
     {
-        if (input.empty())
+        return encode_check(input.data(), input.size());
+    }
+
+    std::string encode_check(const uint8_t *data, size_t length)
+    {
+        if (length == 0)
         {
             return {};
         }
 
-        Serialization::serializer_t writer;
+        /**
+         * The payload and its checksum pack into one buffer sized exactly once
+         * with the checksum hashed straight off the caller's bytes
+         */
+        const auto hash = crypto_hash_t::sha3(data, length);
+
+        std::vector<uint8_t> buffer;
 
-        writer.bytes(input);
+        buffer.reserve(length + CRYPTO_BASE58_CHECKSUM_SIZE);
 
-        const auto hash = crypto_hash_t::sha3(writer.data(), writer.size());
+        buffer.assign(data, data + length);
 
-        writer.bytes(hash.data(), CRYPTO_BASE58_CHECKSUM_SIZE);
+        buffer.insert(buffer.end(), hash.data(), hash.data() + CRYPTO_BASE58_CHECKSUM_SIZE);
 
-        return encode(writer.vector());
+        return encode(buffer.data(), buffer.size());
     }
 
     std::string encode_check(const Serialization::deserializer_t &reader)
@@ -266,6 +320,7 @@ namespace Crypto::Base58
 
     std::string encode_check(const Serialization::serializer_t &writer)
     {
-        return encode_check(writer.vector());
+        // reads straight out of the serializer storage with no staging copy
+        return encode_check(writer.data(), writer.size());
     }
 } // namespace Crypto::Base58
@@ -92,71 +92,107 @@ static inline uint64_t mul128(uint64_t multiplier, uint64_t multiplicand, uint64
 
 namespace Crypto::CNBase58
 {
-    const char BASE58_ALPHABET[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+    constexpr char BASE58_ALPHABET[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
 
-    const size_t BASE58_ALPHABET_SIZE = sizeof(BASE58_ALPHABET) - 1;
+    constexpr size_t BASE58_ALPHABET_SIZE = sizeof(BASE58_ALPHABET) - 1;
 
-    const size_t ENCODED_BLOCK_SIZES[] = {0, 2, 3, 5, 6, 7, 9, 10, 11};
+    constexpr size_t ENCODED_BLOCK_SIZES[] = {0, 2, 3, 5, 6, 7, 9, 10, 11};
 
-    const size_t FULL_BLOCK_SIZE = sizeof(ENCODED_BLOCK_SIZES) / sizeof(ENCODED_BLOCK_SIZES[0]) - 1;
+    constexpr size_t FULL_BLOCK_SIZE = sizeof(ENCODED_BLOCK_SIZES) / sizeof(ENCODED_BLOCK_SIZES[0]) - 1;
 
-    const size_t FULL_ENCODED_BLOCK_SIZE = ENCODED_BLOCK_SIZES[FULL_BLOCK_SIZE];
+    constexpr size_t FULL_ENCODED_BLOCK_SIZE = ENCODED_BLOCK_SIZES[FULL_BLOCK_SIZE];
 
-    struct cn_base58_reverse_alphabet
+    /**
+     * All of the block conversion tables below are computed at compile time
+     * straight into .rodata: the reverse alphabet, the encoded-to-decoded
+     * block size map, and the per-position divisor (order) chain used by the
+     * block decoder
+     */
+
+    struct cn_base58_reverse_alphabet_t
     {
-        cn_base58_reverse_alphabet()
-        {
-            m_data.resize(BASE58_ALPHABET[BASE58_ALPHABET_SIZE - 1] - BASE58_ALPHABET[0] + 1, -1);
+        int8_t data['z' - '1' + 1] = {};
+    };
 
-            for (size_t i = 0; i < BASE58_ALPHABET_SIZE; ++i)
-            {
-                auto idx = static_cast<size_t>(BASE58_ALPHABET[i] - BASE58_ALPHABET[0]);
+    constexpr cn_base58_reverse_alphabet_t build_reverse_alphabet()
+    {
+        cn_base58_reverse_alphabet_t table {};
 
-                m_data[idx] = static_cast<int8_t>(i);
-            }
+        for (auto &entry : table.data)
+        {
+            entry = -1;
         }
 
-        int operator()(char letter) const
+        for (size_t i = 0; i < BASE58_ALPHABET_SIZE; ++i)
         {
-            auto idx = static_cast<size_t>(letter - BASE58_ALPHABET[0]);
-
-            return idx < m_data.size() ? m_data[idx] : -1;
+            table.data[BASE58_ALPHABET[i] - BASE58_ALPHABET[0]] = int8_t(i);
         }
 
-        static cn_base58_reverse_alphabet instance;
+        return table;
+    }
 
-      private:
-        std::vector<int8_t> m_data;
-    };
+    constexpr auto REVERSE_ALPHABET = build_reverse_alphabet();
 
-    cn_base58_reverse_alphabet cn_base58_reverse_alphabet::instance;
+    static inline int reverse_alphabet(char letter)
+    {
+        const auto idx = size_t(letter - BASE58_ALPHABET[0]);
 
-    struct decoded_block_sizes
+        return idx < sizeof(REVERSE_ALPHABET.data) ? REVERSE_ALPHABET.data[idx] : -1;
+    }
+
+    struct decoded_block_sizes_t
     {
-        decoded_block_sizes()
-        {
-            m_data.resize(ENCODED_BLOCK_SIZES[FULL_BLOCK_SIZE] + 1, -1);
+        int data[FULL_ENCODED_BLOCK_SIZE + 1] = {};
+    };
 
-            for (size_t i = 0; i <= FULL_BLOCK_SIZE; ++i)
-            {
-                m_data[ENCODED_BLOCK_SIZES[i]] = static_cast<int>(i);
-            }
-        }
+    constexpr decoded_block_sizes_t build_decoded_block_sizes()
+    {
+        decoded_block_sizes_t table {};
 
-        int operator()(size_t encoded_block_size) const
+        for (auto &entry : table.data)
         {
-            assert(encoded_block_size <= FULL_ENCODED_BLOCK_SIZE);
+            entry = -1;
+        }
 
-            return m_data[encoded_block_size];
+        for (size_t i = 0; i <= FULL_BLOCK_SIZE; ++i)
+        {
+            table.data[ENCODED_BLOCK_SIZES[i]] = int(i);
         }
 
-        static decoded_block_sizes instance;
+        return table;
+    }
+
+    constexpr auto DECODED_BLOCK_SIZES = build_decoded_block_sizes();
+
+    static inline int decoded_block_size(size_t encoded_block_size)
+    {
+        assert(encoded_block_size <= FULL_ENCODED_BLOCK_SIZE);
+
+        return DECODED_BLOCK_SIZES.data[encoded_block_size];
+    }
 
-      private:
-        std::vector<int> m_data;
+    struct order_powers_t
+    {
+        uint64_t data[FULL_ENCODED_BLOCK_SIZE] = {};
     };
 
-    decoded_block_sizes decoded_block_sizes::instance;
+    constexpr order_powers_t build_order_powers()
+    {
+        order_powers_t table {};
+
+        uint64_t order = 1;
+
+        for (auto &entry : table.data)
+        {
+            entry = order;
+
+            order *= BASE58_ALPHABET_SIZE; // never overflows, 58^10 < 2^64
+        }
+
+        return table;
+    }
+
+    constexpr auto ORDER_POWERS = build_order_powers();
 
     static uint64_t uint_8be_to_64(const uint8_t *data, size_t size)
     {
@@ -210,7 +246,7 @@ namespace Crypto::CNBase58
     {
         assert(1 <= size && size <= FULL_ENCODED_BLOCK_SIZE);
 
-        int res_size = decoded_block_sizes::instance(size);
+        int res_size = decoded_block_size(size);
 
         if (res_size <= 0)
         {
@@ -219,11 +255,9 @@ namespace Crypto::CNBase58
 
         uint64_t res_num = 0;
 
-        uint64_t order = 1;
-
         for (size_t i = size - 1; i < size; --i)
         {
-            int digit = cn_base58_reverse_alphabet::instance(block[i]);
+            int digit = reverse_alphabet(block[i]);
 
             if (digit < 0)
             {
@@ -232,7 +266,7 @@ namespace Crypto::CNBase58
 
             uint64_t product_hi;
 
-            uint64_t tmp = res_num + mul128(order, digit, &product_hi);
+            uint64_t tmp = res_num + mul128(ORDER_POWERS.data[size - 1 - i], digit, &product_hi);
 
             if (tmp < res_num || 0 != product_hi)
             {
@@ -240,8 +274,6 @@ namespace Crypto::CNBase58
             }
 
             res_num = tmp;
-
-            order *= BASE58_ALPHABET_SIZE; // Never overflows, 58^10 < 2^64
         }
 
         if (static_cast<size_t>(res_size) < FULL_BLOCK_SIZE && (UINT64_C(1) << (8 * res_size)) <= res_num)
@@ -285,7 +317,7 @@ namespace Crypto::CNBase58
 
         size_t last_block_size = input.size() % FULL_ENCODED_BLOCK_SIZE;
 
-        int last_block_decoded_size = decoded_block_sizes::instance(last_block_size);
+        int last_block_decoded_size = decoded_block_size(last_block_size);
 
         if (last_block_decoded_size < 0)
         {
@@ -361,12 +393,34 @@ namespace Crypto::CNBase58
 
     std::string encode(const std::vector<uint8_t> &input)
     {
-        if (input.empty())
+        return encode(input.data(), input.size());
+    }
+
+    std::string encode(const uint8_t *data_in, size_t length)
+    {
+        if (length == 0)
         {
             return {};
         }
 
-        const auto &data = input;
+        struct span_t
+        {
+            const uint8_t *ptr;
+
+            size_t length;
+
+            [[nodiscard]] const uint8_t *data() const
+            {
+                return ptr;
+            }
+
+            [[nodiscard]] size_t size() const
+            {
+                return length;
+            }
+        };
+
+        const span_t data = {data_in, length};
 
         size_t full_block_count = data.size() / FULL_BLOCK_SIZE;
 
@@ -28,9 +28,10 @@
 
 namespace Crypto::Mnemonics::Language::Chinese::Simplified
 {
-    std::vector<std::string> word_list()
+    const std::vector<std::string> &word_list()
     {
-        return {
+        // built lazily on first use and shared by reference thereafter
+        static const std::vector<std::string> words = {
             "的", "一", "是", "在", "不", "了", "有", "和", "人", "这", "中", "大", "为", "上", "个", "国", "我", "以",
             "要", "他", "时", "来", "用", "们", "生", "到", "作", "地", "于", "出", "就", "分", "对", "成", "会", "可",
             "主", "发", "年", "动", "同", "工", "也", "能", "下", "过", "子", "说", "产", "种", "面", "而", "方", "后",
@@ -145,5 +146,7 @@ namespace Crypto::Mnemonics::Language::Chinese::Simplified
             "戈", "驳", "嫂", "裕", "徙", "箭", "捐", "肠", "撑", "晒", "辨", "殿", "莲", "摊", "搅", "酱", "屏", "疫",
             "哀", "蔡", "堵", "沫", "皱", "畅", "叠", "阁", "莱", "敲", "辖", "钩", "痕", "坝", "巷", "饿", "祸", "丘",
             "玄", "溜", "曰", "逻", "彭", "尝", "卿", "妨", "艇", "吞", "韦", "怨", "矮", "歇"};
+
+        return words;
     }
 } // namespace Crypto::Mnemonics::Language::Chinese::Simplified
@@ -28,9 +28,10 @@
 
 namespace Crypto::Mnemonics::Language::Chinese::Traditional
 {
-    std::vector<std::string> word_list()
+    const std::vector<std::string> &word_list()
     {
-        return {
+        // built lazily on first use and shared by reference thereafter
+        static const std::vector<std::string> words = {
             "的", "一", "是", "在", "不", "了", "有", "和", "人", "這", "中", "大", "為", "上", "個", "國", "我", "以",
             "要", "他", "時", "來", "用", "們", "生", "到", "作", "地", "於", "出", "就", "分", "對", "成", "會", "可",
             "主", "發", "年", "動", "同", "工", "也", "能", "下", "過", "子", "說", "產", "種", "面", "而", "方", "後",
@@ -145,5 +146,7 @@ namespace Crypto::Mnemonics::Language::Chinese::Traditional
             "戈", "駁", "嫂", "裕", "徙", "箭", "捐", "腸", "撐", "曬", "辨", "殿", "蓮", "攤", "攪", "醬", "屏", "疫",
             "哀", "蔡", "堵", "沫", "皺", "暢", "疊", "閣", "萊", "敲", "轄", "鉤", "痕", "壩", "巷", "餓", "禍", "丘",
             "玄", "溜", "曰", "邏", "彭", "嘗", "卿", "妨", "艇", "吞", "韋", "怨", "矮", "歇"};
+
+        return words;
     }
 } // namespace Crypto::Mnemonics::Language::Chinese::Traditional
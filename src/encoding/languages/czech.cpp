@@ -28,9 +28,10 @@
 
 namespace Crypto::Mnemonics::Language::Czech
 {
-    std::vector<std::string> word_list()
+    const std::vector<std::string> &word_list()
     {
-        return {
+        // built lazily on first use and shared by reference thereafter
+        static const std::vector<std::string> words = {
             "abdikace", "abeceda",  "adresa",   "agrese",   "akce",     "aktovka",  "alej",     "alkohol",  "amputace",
             "ananas",   "andulka",  "anekdota", "anketa",   "antika",   "anulovat", "archa",    "arogance", "asfalt",
             "asistent", "aspirace", "astma",    "astronom", "atlas",    "atletika", "atol",     "autobus",  "azyl",
@@ -259,5 +260,7 @@ namespace Crypto::Mnemonics::Language::Czech
             "zprava",   "zprostit", "zprudka",  "zprvu",    "zrada",    "zranit",   "zrcadlo",  "zrnitost", "zrno",
             "zrovna",   "zrychlit", "zrzavost", "zticha",   "ztratit",  "zubovina", "zubr",     "zvednout", "zvenku",
             "zvesela",  "zvon",     "zvrat",    "zvukovod", "zvyk"};
+
+        return words;
     }
 } // namespace Crypto::Mnemonics::Language::Czech
@@ -28,9 +28,10 @@
 
 namespace Crypto::Mnemonics::Language::English
 {
-    std::vector<std::string> word_list()
+    const std::vector<std::string> &word_list()
     {
-        return {
+        // built lazily on first use and shared by reference thereafter
+        static const std::vector<std::string> words = {
             "abandon",  "ability",  "able",     "about",    "above",    "absent",   "absorb",   "abstract", "absurd",
             "abuse",    "access",   "accident", "account",  "accuse",   "achieve",  "acid",     "acoustic", "acquire",
             "across",   "act",      "action",   "actor",    "actress",  "actual",   "adapt",    "add",      "addict",
@@ -259,5 +260,7 @@ namespace Crypto::Mnemonics::Language::English
             "wood",     "wool",     "word",     "work",     "world",    "worry",    "worth",    "wrap",     "wreck",
             "wrestle",  "wrist",    "write",    "wrong",    "yard",     "year",     "yellow",   "you",      "young",
             "youth",    "zebra",    "zero",     "zone",     "zoo"};
+
+        return words;
     }
 } // namespace Crypto::Mnemonics::Language::English
@@ -28,9 +28,10 @@
 
 namespace Crypto::Mnemonics::Language::French
 {
-    std::vector<std::string> word_list()
+    const std::vector<std::string> &word_list()
     {
-        return {
+        // built lazily on first use and shared by reference thereafter
+        static const std::vector<std::string> words = {
             "abaisser", "abandon",  "abdiquer", "abeille",  "abolir",   "aborder",  "aboutir",  "aboyer",   "abrasif",
             "abreuver", "abriter",  "abroger",  "abrupt",   "absence",  "absolu",   "absurde",  "abusif",   "abyssal",
             "académie", "acajou",   "acarien",  "accabler", "accepter", "acclamer", "accolade", "accroche", "accuser",
@@ -259,5 +260,7 @@ namespace Crypto::Mnemonics::Language::French
             "vivipare", "vocation", "voguer",   "voile",    "voisin",   "voiture",  "volaille", "volcan",   "voltiger",
             "volume",   "vorace",   "vortex",   "voter",    "vouloir",  "voyage",   "voyelle",  "wagon",    "xénon",
             "yacht",    "zèbre",    "zénith",   "zeste",    "zoologie"};
+
+        return words;
     }
 } // namespace Crypto::Mnemonics::Language::French
@@ -28,9 +28,10 @@
 
 namespace Crypto::Mnemonics::Language::Italian
 {
-    std::vector<std::string> word_list()
+    const std::vector<std::string> &word_list()
     {
-        return {"abaco",     "abbaglio",  "abbinato",  "abete",     "abisso",    "abolire",   "abrasivo",  "abrogato",
+        // built lazily on first use and shared by reference thereafter
+        static const std::vector<std::string> words = {"abaco",     "abbaglio",  "abbinato",  "abete",     "abisso",    "abolire",   "abrasivo",  "abrogato",
                 "accadere",  "accenno",   "accusato",  "acetone",   "achille",   "acido",     "acqua",     "acre",
                 "acrilico",  "acrobata",  "acuto",     "adagio",    "addebito",  "addome",    "adeguato",  "aderire",
                 "adipe",     "adottare",  "adulare",   "affabile",  "affetto",   "affisso",   "affranto",  "aforisma",
@@ -286,5 +287,7 @@ namespace Crypto::Mnemonics::Language::Italian
                 "volere",    "volpe",     "voragine",  "vulcano",   "zampogna",  "zanna",     "zappato",   "zattera",
                 "zavorra",   "zefiro",    "zelante",   "zelo",      "zenzero",   "zerbino",   "zibetto",   "zinco",
                 "zircone",   "zitto",     "zolla",     "zotico",    "zucchero",  "zufolo",    "zulu",      "zuppa"};
+
+        return words;
     }
 } // namespace Crypto::Mnemonics::Language::Italian
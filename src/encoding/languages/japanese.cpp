@@ -28,9 +28,10 @@
 
 namespace Crypto::Mnemonics::Language::Japanese
 {
-    std::vector<std::string> word_list()
+    const std::vector<std::string> &word_list()
     {
-        return {"あいこくしん", "あいさつ",     "あいだ",         "あおぞら",     "あかちゃん",     "あきる",
+        // built lazily on first use and shared by reference thereafter
+        static const std::vector<std::string> words = {"あいこくしん", "あいさつ",     "あいだ",         "あおぞら",     "あかちゃん",     "あきる",
                 "あけがた",     "あける",       "あこがれる",     "あさい",       "あさひ",         "あしあと",
                 "あじわう",     "あずかる",     "あずき",         "あそぶ",       "あたえる",       "あたためる",
                 "あたりまえ",   "あたる",       "あつい",         "あつかう",     "あっしゅく",     "あつまり",
@@ -372,5 +373,7 @@ namespace Crypto::Mnemonics::Language::Japanese
                 "ろれつ",       "ろんぎ",       "ろんぱ",         "ろんぶん",     "ろんり",         "わかす",
                 "わかめ",       "わかやま",     "わかれる",       "わしつ",       "わじまし",       "わすれもの",
                 "わらう",       "われる"};
+
+        return words;
     }
 } // namespace Crypto::Mnemonics::Language::Japanese
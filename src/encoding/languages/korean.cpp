@@ -28,9 +28,10 @@
 
 namespace Crypto::Mnemonics::Language::Korean
 {
-    std::vector<std::string> word_list()
+    const std::vector<std::string> &word_list()
     {
-        return {
+        // built lazily on first use and shared by reference thereafter
+        static const std::vector<std::string> words = {
             "가격",
             "가끔",
             "가난",
@@ -2079,5 +2080,7 @@ namespace Crypto::Mnemonics::Language::Korean
             "희생",
             "흰색",
             "힘껏"};
+
+        return words;
     }
 } // namespace Crypto::Mnemonics::Language::Korean
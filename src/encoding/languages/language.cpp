@@ -43,7 +43,7 @@ static inline size_t WORD_MAX_LENGTH = 100;
 
 namespace Crypto::Mnemonics::Language
 {
-    std::vector<std::string> select_word_list(const Language &language)
+    const std::vector<std::string> &select_word_list(const Language &language)
     {
         switch (language)
         {
@@ -100,8 +100,6 @@ namespace Crypto::Mnemonics::Language
 
     size_t select_word_list_size(const Language &language)
     {
-        const auto words = select_word_list(language);
-
-        return words.size();
+        return select_word_list(language).size();
     }
 } // namespace Crypto::Mnemonics::Language
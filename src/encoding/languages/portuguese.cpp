@@ -28,9 +28,10 @@
 
 namespace Crypto::Mnemonics::Language::Portuguese
 {
-    std::vector<std::string> word_list()
+    const std::vector<std::string> &word_list()
     {
-        return {
+        // built lazily on first use and shared by reference thereafter
+        static const std::vector<std::string> words = {
             "abacate",  "abaixo",   "abalar",   "abater",   "abduzir",  "abelha",   "aberto",   "abismo",   "abotoar",
             "abranger", "abreviar", "abrigar",  "abrupto",  "absinto",  "absoluto", "absurdo",  "abutre",   "acabado",
             "acalmar",  "acampar",  "acanhar",  "acaso",    "aceitar",  "acelerar", "acenar",   "acervo",   "acessar",
@@ -259,5 +260,7 @@ namespace Crypto::Mnemonics::Language::Portuguese
             "voador",   "voar",     "vogal",    "volante",  "voleibol", "voltagem", "volumoso", "vontade",  "vulto",
             "vuvuzela", "xadrez",   "xarope",   "xeque",    "xeretar",  "xerife",   "xingar",   "zangado",  "zarpar",
             "zebu",     "zelador",  "zombar",   "zoologia", "zumbido"};
+
+        return words;
     }
 } // namespace Crypto::Mnemonics::Language::Portuguese
@@ -28,9 +28,10 @@
 
 namespace Crypto::Mnemonics::Language::Spanish
 {
-    std::vector<std::string> word_list()
+    const std::vector<std::string> &word_list()
     {
-        return {
+        // built lazily on first use and shared by reference thereafter
+        static const std::vector<std::string> words = {
             "ábaco",    "abdomen",  "abeja",    "abierto",  "abogado",  "abono",    "aborto",   "abrazo",   "abrir",
             "abuelo",   "abuso",    "acabar",   "academia", "acceso",   "acción",   "aceite",   "acelga",   "acento",
             "aceptar",  "ácido",    "aclarar",  "acné",     "acoger",   "acoso",    "activo",   "acto",     "actriz",
@@ -259,5 +260,7 @@ namespace Crypto::Mnemonics::Language::Spanish
             "voraz",    "votar",    "voto",     "voz",      "vuelo",    "vulgar",   "yacer",    "yate",     "yegua",
             "yema",     "yerno",    "yeso",     "yodo",     "yoga",     "yogur",    "zafiro",   "zanja",    "zapato",
             "zarza",    "zona",     "zorro",    "zumo",     "zurdo"};
+
+        return words;
     }
 } // namespace Crypto::Mnemonics::Language::Spanish
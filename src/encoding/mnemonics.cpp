@@ -24,7 +24,9 @@
 // STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <bitset>
+#include <crypto_parallel.h>
 #include <encoding/mnemonics.h>
 #include <helpers/debug_helper.h>
 #include <map>
@@ -34,6 +36,14 @@
 static std::map<Crypto::Mnemonics::Language::Language, std::vector<std::string>> cached_trimmed_words =
     std::map<Crypto::Mnemonics::Language::Language, std::vector<std::string>>();
 
+/**
+ * Word-to-index maps are built lazily per language (over the trimmed word
+ * forms) so that decoding looks a word up in O(1) instead of scanning the
+ * word list per word
+ */
+static std::map<Crypto::Mnemonics::Language::Language, std::map<std::string, size_t>> cached_word_indexes =
+    std::map<Crypto::Mnemonics::Language::Language, std::map<std::string, size_t>>();
+
 static inline std::string utf8_substr(const std::string &str, size_t length)
 {
     if (length == 0)
@@ -160,7 +170,7 @@ namespace Crypto::Mnemonics
 
     std::vector<std::string> encode(const std::vector<unsigned char> &input, const Language::Language &language)
     {
-        const auto selected_word_list = Language::select_word_list(language);
+        const auto &selected_word_list = Language::select_word_list(language);
 
         if (input.size() != 32 && input.size() != 16)
         {
@@ -207,6 +217,62 @@ namespace Crypto::Mnemonics
         return encode(wallet_seed.serialize(), language);
     }
 
+    /**
+     * Reads the 11-bit word group starting at the given bit offset (MSB first)
+     * @param data
+     * @param bit_offset
+     * @return
+     */
+    static uint32_t extract_word_index(const std::vector<unsigned char> &data, size_t bit_offset)
+    {
+        uint32_t result = 0;
+
+        for (size_t bit = bit_offset; bit < bit_offset + 11; ++bit)
+        {
+            result = (result << 1) | ((data[bit / 8] >> (7 - (bit % 8))) & 0x01);
+        }
+
+        return result;
+    }
+
+    std::vector<std::vector<std::string_view>>
+        encode_batch(const std::vector<crypto_entropy_t> &entropy, const Language::Language &language)
+    {
+        const auto &selected_word_list = Language::select_word_list(language);
+
+        std::vector<std::vector<std::string_view>> results(entropy.size());
+
+        Crypto::Parallel::parallel_for(
+            0,
+            entropy.size(),
+            [&](size_t i)
+            {
+                auto data = entropy[i].serialize();
+
+                const auto hash = crypto_hash_t::sha256(data);
+
+                /**
+                 * The checksum bits ride at the tail exactly as in the
+                 * single-shot encoder: a full byte for 32-byte entropy and the
+                 * top nibble for 16-byte entropy
+                 */
+                const auto bits = (data.size() * 8) + (data.size() == 32 ? 8 : 4);
+
+                data.push_back(hash[0]);
+
+                auto &words = results[i];
+
+                words.reserve(bits / 11);
+
+                for (size_t offset = 0; offset + 11 <= bits; offset += 11)
+                {
+                    words.emplace_back(selected_word_list[extract_word_index(data, offset)]);
+                }
+            });
+
+        return results;
+    }
+
     std::vector<Language::Language> languages()
     {
         auto result = std::vector<Language::Language>();
@@ -228,24 +294,127 @@ namespace Crypto::Mnemonics
         return result;
     }
 
+    /**
+     * The per-language prefix index: the full words paired with their word
+     * list indexes, ordered lexicographically so any prefix maps to a
+     * contiguous run located with one binary search; built once per language
+     */
+    static std::map<Language::Language, std::vector<std::pair<std::string, size_t>>> cached_prefix_indexes;
+
+    static const std::vector<std::pair<std::string, size_t>> &prefix_index(const Language::Language &language)
+    {
+        if (cached_prefix_indexes.find(language) == cached_prefix_indexes.end())
+        {
+            const auto &selected_word_list = Language::select_word_list(language);
+
+            std::vector<std::pair<std::string, size_t>> index;
+
+            index.reserve(selected_word_list.size());
+
+            for (size_t i = 0; i < selected_word_list.size(); ++i)
+            {
+                index.emplace_back(selected_word_list[i], i);
+            }
+
+            std::sort(index.begin(), index.end());
+
+            cached_prefix_indexes.emplace(language, std::move(index));
+        }
+
+        return cached_prefix_indexes.at(language);
+    }
+
+    std::vector<std::string> complete_word_prefix(const std::string &prefix, const Language::Language &language)
+    {
+        const auto &index = prefix_index(language);
+
+        std::vector<std::string> results;
+
+        auto it = std::lower_bound(
+            index.begin(),
+            index.end(),
+            prefix,
+            [](const std::pair<std::string, size_t> &entry, const std::string &value) { return entry.first < value; });
+
+        for (; it != index.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it)
+        {
+            results.push_back(it->first);
+        }
+
+        return results;
+    }
+
+    std::tuple<bool, size_t> resolve_word_prefix(const std::string &prefix, const Language::Language &language)
+    {
+        if (prefix.empty())
+        {
+            return {false, 0};
+        }
+
+        const auto &index = prefix_index(language);
+
+        auto it = std::lower_bound(
+            index.begin(),
+            index.end(),
+            prefix,
+            [](const std::pair<std::string, size_t> &entry, const std::string &value) { return entry.first < value; });
+
+        bool found = false;
+
+        size_t result = 0;
+
+        for (; it != index.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it)
+        {
+            // an exact full-word match always wins over longer completions
+            if (it->first == prefix)
+            {
+                return {true, it->second};
+            }
+
+            if (found)
+            {
+                return {false, 0};
+            }
+
+            found = true;
+
+            result = it->second;
+        }
+
+        return {found, result};
+    }
+
     size_t word_index(const std::string &word, const Language::Language &language)
     {
-        const auto trimmed_word_list = word_list_trimmed(language);
+        // if the index does not exist for the language, we need to generate it
+        if (cached_word_indexes.find(language) == cached_word_indexes.end())
+        {
+            const auto &trimmed_word_list = word_list_trimmed(language);
+
+            auto index = std::map<std::string, size_t>();
+
+            for (size_t i = 0; i < trimmed_word_list.size(); ++i)
+            {
+                index.emplace(trimmed_word_list[i], i);
+            }
+
+            cached_word_indexes.emplace(language, std::move(index));
+        }
 
         const auto word_list_prefix_length = Language::select_word_list_prefix(language);
 
         const auto trimmed_word = utf8_substr(word, word_list_prefix_length);
 
-        auto it = std::find(trimmed_word_list.begin(), trimmed_word_list.end(), trimmed_word);
+        const auto &index = cached_word_indexes.at(language);
 
-        if (it != trimmed_word_list.end())
-        {
-            return it - trimmed_word_list.begin();
-        }
-        else
+        const auto it = index.find(trimmed_word);
+
+        if (it != index.end())
         {
-            return -1;
+            return it->second;
         }
+
+        return -1;
     }
 
     std::vector<std::string> word_list(const Language::Language &language)
@@ -253,12 +422,12 @@ namespace Crypto::Mnemonics
         return Language::select_word_list(language);
     }
 
-    std::vector<std::string> word_list_trimmed(const Language::Language &language)
+    const std::vector<std::string> &word_list_trimmed(const Language::Language &language)
     {
         // If the cache does not exist, we need to generate it
         if (cached_trimmed_words.find(language) == cached_trimmed_words.end())
         {
-            const auto selected_word_list = Language::select_word_list(language);
+            const auto &selected_word_list = Language::select_word_list(language);
 
             const auto word_list_prefix_length = Language::select_word_list_prefix(language);
 
@@ -0,0 +1,150 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <helpers/fixed_base_table_t.h>
+#include <types/crypto_scalar_t.h>
+
+fixed_base_table_t::fixed_base_table_t(const crypto_point_t &base): base_point(base)
+{
+    table.resize(WINDOWS);
+
+    /**
+     * Each row holds the multiples {1..15} of the row base where the row base
+     * for row w is (16 ^ w) * base; rather than performing a scalar
+     * multiplication per entry, each row is built from 14 point additions and
+     * the next row base is reached with 4 doublings of the current one
+     */
+    auto row_base = base;
+
+    for (size_t w = 0; w < WINDOWS; ++w)
+    {
+        auto &row = table[w];
+
+        row.reserve(DIGITS);
+
+        row.push_back(row_base);
+
+        for (size_t d = 1; d < DIGITS; ++d)
+        {
+            row.push_back(row.back() + row_base);
+        }
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            row_base += row_base;
+        }
+    }
+}
+
+crypto_point_t fixed_base_table_t::base() const
+{
+    return base_point;
+}
+
+crypto_point_t
+    fixed_base_table_t::dbl_mult(const crypto_scalar_t &a, const fixed_base_table_t &other, const crypto_scalar_t &b) const
+{
+    auto result = Crypto::Z;
+
+    /**
+     * Both digit streams share a single pass so each non-zero window of either
+     * scalar costs exactly one table addition and no doublings are performed
+     */
+    for (size_t w = 0; w < WINDOWS; ++w)
+    {
+        const auto digit_a = (w % 2 == 0) ? size_t(a[w / 2] & 0x0f) : size_t(a[w / 2] >> 4);
+
+        const auto digit_b = (w % 2 == 0) ? size_t(b[w / 2] & 0x0f) : size_t(b[w / 2] >> 4);
+
+        if (digit_a != 0)
+        {
+            result += table[w][digit_a - 1];
+        }
+
+        if (digit_b != 0)
+        {
+            result += other.table[w][digit_b - 1];
+        }
+    }
+
+    return result;
+}
+
+crypto_point_t fixed_base_table_t::mul(const crypto_scalar_t &scalar) const
+{
+    auto result = Crypto::Z;
+
+    for (size_t w = 0; w < WINDOWS; ++w)
+    {
+        // the low nibble of the byte holds the even window, the high nibble the odd
+        const auto digit = (w % 2 == 0) ? size_t(scalar[w / 2] & 0x0f) : size_t(scalar[w / 2] >> 4);
+
+        if (digit != 0)
+        {
+            result += table[w][digit - 1];
+        }
+    }
+
+    return result;
+}
+
+namespace Crypto
+{
+    const fixed_base_table_t &G_table()
+    {
+        static const fixed_base_table_t table(Crypto::G);
+
+        return table;
+    }
+
+    const fixed_base_table_t &H_table()
+    {
+        static const fixed_base_table_t table(Crypto::H);
+
+        return table;
+    }
+
+    const fixed_base_table_t &U_table()
+    {
+        static const fixed_base_table_t table(Crypto::U);
+
+        return table;
+    }
+
+    const fixed_base_table_t &G_inv8_table()
+    {
+        static const fixed_base_table_t table(Crypto::INV_EIGHT * Crypto::G);
+
+        return table;
+    }
+
+    const fixed_base_table_t &H_inv8_table()
+    {
+        static const fixed_base_table_t table(Crypto::INV_EIGHT * Crypto::H);
+
+        return table;
+    }
+} // namespace Crypto
@@ -35,54 +35,80 @@ gray_code_generator_t::gray_code_generator_t(size_t N, size_t K, size_t v): N(N)
 
     u = std::vector<int>(K + 1, 1);
 
-    changed.resize(1);
+    count = size_t(crypto_scalar_t(N).pow(K).to_uint64_t());
+
+    /**
+     * When a target index was supplied the decomposition at that index is
+     * captured by streaming a scratch copy of the state up to it; no table of
+     * the intermediate codes is ever stored
+     */
+    if (v != size_t(-1))
+    {
+        auto sg = g, su = u;
 
-    changed[0] = {0, 0, 0};
+        for (size_t idx = 0; idx + 1 < count; ++idx)
+        {
+            if (idx == v)
+            {
+                break;
+            }
 
-    generate();
-}
+            int i = 0, k = sg[0] + su[0];
 
-std::vector<int> gray_code_generator_t::operator[](int i) const
-{
-    return changed[i];
-}
+            while (k >= int(N) || k < 0)
+            {
+                su[i] = su[i] * -1;
 
-void gray_code_generator_t::generate()
-{
-    const auto upper = size_t(crypto_scalar_t(N).pow(K).to_uint64_t()) - 1;
+                i += 1;
 
-    for (size_t idx = 0; idx < upper; ++idx)
-    {
-        if (idx == v)
+                k = sg[i] + su[i];
+            }
+
+            sg[i] = k;
+        }
+
+        if (v < count)
         {
-            v_changed = std::vector<int>(g.begin(), g.end() - 1);
+            v_changed = std::vector<int>(sg.begin(), sg.end() - 1);
         }
+    }
+}
 
-        int i = 0, k = g[0] + u[0];
+bool gray_code_generator_t::advance()
+{
+    if (index + 1 >= count)
+    {
+        return false;
+    }
 
-        while (k >= N || k < 0)
-        {
-            u[i] = u[i] * -1;
+    index += 1;
 
-            i += 1;
+    int i = 0, k = g[0] + u[0];
 
-            k = g[i] + u[i];
-        }
+    while (k >= int(N) || k < 0)
+    {
+        u[i] = u[i] * -1;
 
-        changed.push_back({i, g[i], k});
+        i += 1;
 
-        g[i] = k;
+        k = g[i] + u[i];
     }
+
+    changed = {i, g[i], k};
+
+    g[i] = k;
+
+    return true;
 }
 
-size_t gray_code_generator_t::size() const
+const std::array<int, 3> &gray_code_generator_t::current() const
 {
-    return changed.size();
+    return changed;
 }
 
-std::vector<std::vector<int>> gray_code_generator_t::values() const
+size_t gray_code_generator_t::size() const
 {
-    return changed;
+    return count;
 }
 
 std::vector<int> gray_code_generator_t::v_value() const
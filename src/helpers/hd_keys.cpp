@@ -24,12 +24,13 @@
 // STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <cstring>
 #include <cryptopp/hmac.h>
 #include <cryptopp/pwdbased.h>
 #include <cryptopp/sha.h>
 #include <helpers/hd_keys.h>
 
-static std::vector<uint32_t> parse_bip32_path(const std::string &path)
+std::vector<uint32_t> parse_bip32_path(const std::string &path)
 {
     if (path.empty() || path[0] != 'm')
     {
@@ -111,28 +112,52 @@ std::vector<unsigned char>
 {
     std::vector<unsigned char> result(CryptoPP::HMAC<CryptoPP::SHA512>::DIGESTSIZE);
 
-    const auto hmac_context =
-        new CryptoPP::HMAC<CryptoPP::SHA512>(static_cast<const CryptoPP::byte *>(key), key_length);
+    /**
+     * The HMAC context and its expanded key schedule are cached per thread and
+     * only re-keyed when the key actually changes; sibling derivations (same
+     * parent chain code, consecutive indices) therefore restart the existing
+     * schedule instead of rebuilding it for every child step
+     */
+    static thread_local CryptoPP::HMAC<CryptoPP::SHA512> hmac_context;
 
-    hmac_context->Update(static_cast<const CryptoPP::byte *>(message), message_length);
+    static thread_local std::vector<unsigned char> scheduled_key;
 
-    hmac_context->Final(result.data());
+    if (scheduled_key.size() != key_length
+        || std::memcmp(scheduled_key.data(), key, key_length) != 0)
+    {
+        hmac_context.SetKey(static_cast<const CryptoPP::byte *>(key), key_length);
+
+        scheduled_key.assign(
+            static_cast<const unsigned char *>(key), static_cast<const unsigned char *>(key) + key_length);
+    }
+    else
+    {
+        hmac_context.Restart();
+    }
 
-    free(hmac_context);
+    hmac_context.Update(static_cast<const CryptoPP::byte *>(message), message_length);
+
+    hmac_context.Final(result.data());
 
     return result;
 }
 
 std::tuple<crypto_hash_t, crypto_hash_t>
     generate_hd_child_key(const crypto_hash_t &parent_key, const crypto_hash_t &chain_code, const std::string &path)
+{
+    return generate_hd_child_key(parent_key, chain_code, parse_bip32_path(path));
+}
+
+std::tuple<crypto_hash_t, crypto_hash_t> generate_hd_child_key(
+    const crypto_hash_t &parent_key,
+    const crypto_hash_t &chain_code,
+    const std::vector<uint32_t> &parsed_path)
 {
     crypto_hash_t current_key = parent_key;
 
     crypto_hash_t current_chain_code = chain_code;
 
-    const auto indices = parse_bip32_path(path);
-
-    for (const auto index : indices)
+    for (const auto index : parsed_path)
     {
         const auto [child_key, child_chain_code] = generate_hd_child_key(current_key, current_chain_code, index);
 
@@ -0,0 +1,669 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstring>
+#include <fstream>
+#include <helpers/multiexp.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Selects the bucket window width (in bits) for the number of terms provided.
+ * The widths below were arrived at by sweeping the proof sizes that we
+ * typically verify (16 through 4096 terms); wider windows amortize better as
+ * the term count grows but cost more in the final bucket collapse
+ * @param count
+ * @return
+ */
+static size_t select_window_width(size_t count)
+{
+    if (count < 64)
+    {
+        return 4;
+    }
+
+    if (count < 256)
+    {
+        return 5;
+    }
+
+    if (count < 1024)
+    {
+        return 6;
+    }
+
+    if (count < 4096)
+    {
+        return 7;
+    }
+
+    return 8;
+}
+
+/**
+ * Extracts the window of the given width starting at the given bit offset from
+ * the little-endian representation of the scalar
+ * @param scalar
+ * @param offset
+ * @param width
+ * @return
+ */
+static size_t extract_window(const crypto_scalar_t &scalar, size_t offset, size_t width)
+{
+    size_t result = 0;
+
+    for (size_t i = 0; i < width; ++i)
+    {
+        const auto bit = offset + i;
+
+        if (bit >= 256)
+        {
+            break;
+        }
+
+        if ((scalar[bit / 8] >> (bit % 8)) & 0x01)
+        {
+            result |= (size_t(1) << i);
+        }
+    }
+
+    return result;
+}
+
+// the versioned on-disk header of a materialized generator table
+struct generator_table_header_t
+{
+    unsigned char magic[8];
+
+    uint64_t version;
+
+    uint64_t element_size;
+
+    uint64_t count;
+
+    unsigned char parameters_hash[32];
+};
+
+static const unsigned char GENERATOR_TABLE_MAGIC[8] = {'G', 'E', 'N', 'T', 'A', 'B', 'L', 'E'};
+
+static const uint64_t GENERATOR_TABLE_VERSION = 1;
+
+generator_table_t::generator_table_t(const std::vector<crypto_point_t> &points)
+{
+    plane.reserve(points.size());
+
+    for (const auto &point : points)
+    {
+        plane.push_back(point.cached());
+    }
+
+    view = plane.data();
+
+    count = plane.size();
+}
+
+generator_table_t::~generator_table_t()
+{
+    unmap();
+}
+
+bool generator_table_t::load(const std::string &path, const crypto_hash_t &parameters_hash)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+    if (!file.good())
+    {
+        return false;
+    }
+
+    const auto file_size = size_t(file.tellg());
+
+    file.seekg(0);
+
+    if (file_size < sizeof(generator_table_header_t))
+    {
+        return false;
+    }
+
+    generator_table_header_t header = {};
+
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+
+    /**
+     * The header binds the table to its derivation parameters and to this
+     * build's element layout so stale, foreign, or cross-ABI tables are
+     * rejected instead of silently corrupting verification
+     */
+    if (!file.good() || std::memcmp(header.magic, GENERATOR_TABLE_MAGIC, sizeof(header.magic)) != 0
+        || header.version != GENERATOR_TABLE_VERSION || header.element_size != sizeof(ge_cached)
+        || std::memcmp(header.parameters_hash, parameters_hash.data(), 32) != 0)
+    {
+        return false;
+    }
+
+    /**
+     * The declared element count must fit inside the actual file: dividing
+     * keeps the bound exact for hostile counts that would overflow a multiply,
+     * a truncated file is rejected here instead of faulting on first access
+     * past the end of a short mapping, and the no-mapping fallback never
+     * attempts a hostile-sized allocation
+     */
+    if (size_t(header.count) > (file_size - sizeof(header)) / sizeof(ge_cached))
+    {
+        return false;
+    }
+
+    const auto payload_length = size_t(header.count) * sizeof(ge_cached);
+
+    unmap();
+
+#ifndef _WIN32
+    const auto descriptor = open(path.c_str(), O_RDONLY);
+
+    if (descriptor >= 0)
+    {
+        mapping_length = sizeof(header) + payload_length;
+
+        const auto mapped = mmap(nullptr, mapping_length, PROT_READ, MAP_SHARED, descriptor, 0);
+
+        close(descriptor);
+
+        if (mapped != MAP_FAILED)
+        {
+            mapping = mapped;
+
+            view = reinterpret_cast<const ge_cached *>(static_cast<const unsigned char *>(mapped) + sizeof(header));
+
+            count = size_t(header.count);
+
+            plane.clear();
+
+            return true;
+        }
+
+        mapping_length = 0;
+    }
+#endif
+
+    // no mapping available: fall back to reading the plane into private memory
+    plane.resize(size_t(header.count));
+
+    file.read(reinterpret_cast<char *>(plane.data()), payload_length);
+
+    if (!file.good())
+    {
+        plane.clear();
+
+        view = nullptr;
+
+        count = 0;
+
+        return false;
+    }
+
+    view = plane.data();
+
+    count = plane.size();
+
+    return true;
+}
+
+bool generator_table_t::save(const std::string &path, const crypto_hash_t &parameters_hash) const
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+    if (!file.good())
+    {
+        return false;
+    }
+
+    generator_table_header_t header = {};
+
+    std::memcpy(header.magic, GENERATOR_TABLE_MAGIC, sizeof(header.magic));
+
+    header.version = GENERATOR_TABLE_VERSION;
+
+    header.element_size = sizeof(ge_cached);
+
+    header.count = count;
+
+    std::memcpy(header.parameters_hash, parameters_hash.data(), 32);
+
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    file.write(reinterpret_cast<const char *>(view), count * sizeof(ge_cached));
+
+    return file.good();
+}
+
+void generator_table_t::unmap()
+{
+#ifndef _WIN32
+    if (mapping != nullptr)
+    {
+        munmap(mapping, mapping_length);
+
+        mapping = nullptr;
+
+        mapping_length = 0;
+    }
+#endif
+}
+
+/**
+ * Recodes the scalar into signed window digits in the range
+ * [-(2^(width-1)), 2^(width-1)]: digits above the half-window fold negative
+ * with a carry into the next window. Negation of a point is nearly free on
+ * this curve, so signed digits halve the bucket count and the additions the
+ * collapse performs
+ * @param scalar
+ * @param width
+ * @param window_count
+ * @param digits
+ */
+static void recode_signed_digits(const crypto_scalar_t &scalar, size_t width, size_t window_count, int16_t *digits)
+{
+    const int full = 1 << width, half = full >> 1;
+
+    int carry = 0;
+
+    for (size_t window = 0; window < window_count; ++window)
+    {
+        int digit = int(extract_window(scalar, window * width, width)) + carry;
+
+        if (digit > half)
+        {
+            digit -= full;
+
+            carry = 1;
+        }
+        else
+        {
+            carry = 0;
+        }
+
+        digits[window] = int16_t(digit);
+    }
+}
+
+namespace Crypto
+{
+    crypto_point_t
+        multiexp(const std::vector<crypto_scalar_t> &scalars, const std::vector<crypto_point_t> &points)
+    {
+        if (scalars.size() != points.size())
+        {
+            throw std::range_error("vectors must be of equal size");
+        }
+
+        return multiexp(scalars.data(), points.data(), scalars.size());
+    }
+
+    crypto_point_t multiexp(const crypto_scalar_t *scalars, const crypto_point_t *points, size_t count)
+    {
+        if (count == 0)
+        {
+            return Crypto::Z;
+        }
+
+        /**
+         * For small inputs the bucket setup dominates and pairing the terms off via
+         * double scalar multiplication remains the faster option
+         */
+        if (count < CRYPTO_MULTIEXP_THRESHOLD)
+        {
+            const auto n = count / 2;
+
+            auto result = Crypto::Z;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                result += scalars[2 * i].dbl_mult(points[2 * i], scalars[(2 * i) + 1], points[(2 * i) + 1]);
+            }
+
+            if (n * 2 != count)
+            {
+                result += scalars[count - 1] * points[count - 1];
+            }
+
+            return result;
+        }
+
+        const auto width = select_window_width(count);
+
+        // signed digits cover the window with half the buckets
+        const auto bucket_count = size_t(1) << (width - 1);
+
+        const auto window_count = ((256 + width - 1) / width) + 1;
+
+        /**
+         * The signed digits of every scalar are recoded up front (the carries
+         * propagate from the least significant window up, while the
+         * accumulation below walks from the most significant down)
+         */
+        std::vector<int16_t> digits(count * window_count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            recode_signed_digits(scalars[i], width, window_count, digits.data() + (i * window_count));
+        }
+
+        std::vector<crypto_point_t> buckets(bucket_count, Crypto::Z);
+
+        auto result = Crypto::Z;
+
+        /**
+         * Process the windows from the most significant down so that the running
+         * result only needs to be doubled width times between the windows
+         */
+        for (size_t window = window_count; window-- > 0;)
+        {
+            if (result != Crypto::Z)
+            {
+                for (size_t i = 0; i < width; ++i)
+                {
+                    result += result;
+                }
+            }
+
+            for (auto &bucket : buckets)
+            {
+                bucket = Crypto::Z;
+            }
+
+            bool any_used = false;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const auto digit = digits[(i * window_count) + window];
+
+                if (digit > 0)
+                {
+                    buckets[digit - 1] += points[i];
+
+                    any_used = true;
+                }
+                else if (digit < 0)
+                {
+                    // subtraction costs the same as addition on this curve
+                    buckets[-digit - 1] -= points[i];
+
+                    any_used = true;
+                }
+            }
+
+            if (!any_used)
+            {
+                continue;
+            }
+
+            /**
+             * Collapse the buckets via the running sum trick: walking the buckets
+             * from the top down, the running sum visits bucket[j] exactly j + 1
+             * times which weights each bucket by its digit without any
+             * multiplications being performed
+             */
+            auto running = Crypto::Z, window_sum = Crypto::Z;
+
+            for (size_t j = bucket_count; j-- > 0;)
+            {
+                running += buckets[j];
+
+                window_sum += running;
+            }
+
+            result += window_sum;
+        }
+
+        return result;
+    }
+
+    crypto_point_t multi_mult(const crypto_scalar_t *scalars, const crypto_point_t *points, size_t count)
+    {
+        if (count == 0)
+        {
+            return Crypto::Z;
+        }
+
+        if (count == 1)
+        {
+            return scalars[0] * points[0];
+        }
+
+        // past the bucket threshold the Pippenger engine is the better tool
+        if (count >= CRYPTO_MULTIEXP_THRESHOLD)
+        {
+            return multiexp(scalars, points, count);
+        }
+
+        /**
+         * Straus interleaving: each term gets a table of its first fifteen
+         * multiples in cached form and then a single run of doublings is
+         * shared by every term with one table addition per non-zero 4-bit
+         * window, all in extended coordinates without any byte round-trips
+         */
+        std::vector<ge_cached> tables(count * 15);
+
+        ge_p1p1 tmp_p1p1;
+
+        ge_p3 tmp_p3;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto base = points[i].p3();
+
+            tmp_p3 = base;
+
+            ge_p3_to_cached(&tables[i * 15], &tmp_p3);
+
+            for (size_t d = 1; d < 15; ++d)
+            {
+                ge_add(&tmp_p1p1, &base, &tables[(i * 15) + d - 1]);
+
+                ge_p1p1_to_p3(&tmp_p3, &tmp_p1p1);
+
+                ge_p3_to_cached(&tables[(i * 15) + d], &tmp_p3);
+            }
+        }
+
+        auto result = Crypto::Z.p3();
+
+        ge_cached result_cached;
+
+        bool result_nonzero = false;
+
+        for (size_t window = 64; window-- > 0;)
+        {
+            if (result_nonzero)
+            {
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    ge_p3_to_cached(&result_cached, &result);
+
+                    ge_add(&tmp_p1p1, &result, &result_cached);
+
+                    ge_p1p1_to_p3(&result, &tmp_p1p1);
+                }
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                // the low nibble of the byte holds the even window, the high nibble the odd
+                const auto digit = (window % 2 == 0) ? size_t(scalars[i][window / 2] & 0x0f)
+                                                     : size_t(scalars[i][window / 2] >> 4);
+
+                if (digit != 0)
+                {
+                    ge_add(&tmp_p1p1, &result, &tables[(i * 15) + digit - 1]);
+
+                    ge_p1p1_to_p3(&result, &tmp_p1p1);
+
+                    result_nonzero = true;
+                }
+            }
+        }
+
+        return crypto_point_t(result);
+    }
+
+    crypto_point_t multi_mult(const std::vector<crypto_scalar_t> &scalars, const std::vector<crypto_point_t> &points)
+    {
+        if (scalars.size() != points.size())
+        {
+            throw std::range_error("vectors must be of equal size");
+        }
+
+        return multi_mult(scalars.data(), points.data(), scalars.size());
+    }
+
+    crypto_point_t multiexp(const std::vector<crypto_scalar_t> &scalars, const generator_table_t &table)
+    {
+        if (scalars.size() != table.size())
+        {
+            throw std::range_error("vectors must be of equal size");
+        }
+
+        if (scalars.empty())
+        {
+            return Crypto::Z;
+        }
+
+        const auto count = scalars.size();
+
+        const auto width = select_window_width(count);
+
+        // signed digits cover the window with half the buckets
+        const auto bucket_count = size_t(1) << (width - 1);
+
+        const auto window_count = ((256 + width - 1) / width) + 1;
+
+        // recode every scalar's signed digits up front (carries run LSB-first)
+        std::vector<int16_t> digits(count * window_count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            recode_signed_digits(scalars[i], width, window_count, digits.data() + (i * window_count));
+        }
+
+        /**
+         * The whole reduction runs in extended coordinates against the dense
+         * cached plane: buckets accumulate with ge_add/ge_sub straight off the
+         * table and only the final result is ever serialized back to bytes
+         */
+        std::vector<ge_p3> buckets(bucket_count);
+
+        const auto identity = Crypto::Z.p3();
+
+        auto result = identity;
+
+        bool result_nonzero = false;
+
+        ge_p1p1 tmp_p1p1;
+
+        ge_cached tmp_cached;
+
+        for (size_t window = window_count; window-- > 0;)
+        {
+            if (result_nonzero)
+            {
+                for (size_t i = 0; i < width; ++i)
+                {
+                    ge_p3_to_cached(&tmp_cached, &result);
+
+                    ge_add(&tmp_p1p1, &result, &tmp_cached);
+
+                    ge_p1p1_to_p3(&result, &tmp_p1p1);
+                }
+            }
+
+            for (auto &bucket : buckets)
+            {
+                bucket = identity;
+            }
+
+            bool any_used = false;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const auto digit = digits[(i * window_count) + window];
+
+                if (digit > 0)
+                {
+                    ge_add(&tmp_p1p1, &buckets[digit - 1], table.data() + i);
+
+                    ge_p1p1_to_p3(&buckets[digit - 1], &tmp_p1p1);
+
+                    any_used = true;
+                }
+                else if (digit < 0)
+                {
+                    // subtraction costs the same as addition on this curve
+                    ge_sub(&tmp_p1p1, &buckets[-digit - 1], table.data() + i);
+
+                    ge_p1p1_to_p3(&buckets[-digit - 1], &tmp_p1p1);
+
+                    any_used = true;
+                }
+            }
+
+            if (!any_used)
+            {
+                continue;
+            }
+
+            auto running = identity, window_sum = identity;
+
+            for (size_t j = bucket_count; j-- > 0;)
+            {
+                ge_p3_to_cached(&tmp_cached, &buckets[j]);
+
+                ge_add(&tmp_p1p1, &running, &tmp_cached);
+
+                ge_p1p1_to_p3(&running, &tmp_p1p1);
+
+                ge_p3_to_cached(&tmp_cached, &running);
+
+                ge_add(&tmp_p1p1, &window_sum, &tmp_cached);
+
+                ge_p1p1_to_p3(&window_sum, &tmp_p1p1);
+            }
+
+            ge_p3_to_cached(&tmp_cached, &window_sum);
+
+            ge_add(&tmp_p1p1, &result, &tmp_cached);
+
+            ge_p1p1_to_p3(&result, &tmp_p1p1);
+
+            result_nonzero = true;
+        }
+
+        return crypto_point_t(result);
+    }
+} // namespace Crypto
@@ -34,7 +34,15 @@
 #endif
 #endif /* defined(__linux__) */
 
+#include <atomic>
+#include <crypto_config.h>
 #include <helpers/random_bytes.h>
+#include <mutex>
+#include <string.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
 
 // clang-format off
 #if defined(_WIN32)
@@ -405,7 +413,11 @@ static inline int randombytes_js_randombytes_nodejs(void *buf, size_t n)
 }
 #endif /* defined(__EMSCRIPTEN__) */
 
-int random_bytes(size_t n, void *buf)
+/**
+ * Draws the requested number of bytes directly from the operating system's
+ * entropy source
+ */
+static int random_bytes_system(size_t n, void *buf)
 {
 #if defined(__EMSCRIPTEN__)
     return randombytes_js_randombytes_nodejs(buf, n);
@@ -427,3 +439,118 @@ int random_bytes(size_t n, void *buf)
     return randombytes_fallback(static_cast<uint8_t *>(buf), n);
 #endif
 }
+
+
+/**
+ * The explicitly selected deterministic mode for test and benchmark
+ * reproducibility; never engaged unless random_bytes_seed_deterministic()
+ * was called. The generator is guarded by a mutex as the worker pool draws
+ * entropy from many threads -- serializing the draws keeps the stream itself
+ * well-defined (callers wanting exact cross-run byte assignment must also
+ * keep their draw order deterministic, i.e. run single-threaded)
+ */
+static std::atomic<bool> deterministic_mode {false};
+
+static std::mutex deterministic_mutex;
+
+static std::mt19937_64 deterministic_generator;
+
+void random_bytes_seed_deterministic(uint64_t seed)
+{
+    std::scoped_lock lock(deterministic_mutex);
+
+    deterministic_generator.seed(seed);
+
+    deterministic_mode = true;
+}
+
+void random_bytes_use_system_entropy()
+{
+    deterministic_mode = false;
+}
+
+/**
+ * Bumped in the child after fork() so that every thread discards the pool
+ * bytes it inherited from the parent; without this, parent and child would
+ * serve identical "random" bytes until their next refill
+ */
+static std::atomic<uint64_t> fork_generation {0};
+
+#ifndef _WIN32
+static void invalidate_pools_in_child()
+{
+    fork_generation++;
+}
+
+// registered during static initialization, before any fork can occur
+[[maybe_unused]] static const int atfork_registration =
+    pthread_atfork(nullptr, nullptr, invalidate_pools_in_child);
+#endif
+
+int random_bytes(size_t n, void *buf)
+{
+    // the deterministic stream bypasses the pool so runs reproduce exactly
+    if (deterministic_mode)
+    {
+        std::scoped_lock lock(deterministic_mutex);
+
+        auto *bytes = static_cast<uint8_t *>(buf);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            bytes[i] = uint8_t(deterministic_generator());
+        }
+
+        return 0;
+    }
+
+    /**
+     * Small requests (random scalars, masks, nonces) are served from a
+     * thread-local pool that is filled from the operating system in one
+     * request, which removes the per-call syscall from bulk operations like
+     * generating large batches of keys. Every byte served is still straight
+     * OS entropy -- the pool only batches the requests -- and each refill is
+     * effectively a reseed. Served bytes are wiped from the pool immediately
+     * so that key material never lingers in it.
+     */
+    static thread_local unsigned char pool[CRYPTO_RANDOM_BYTES_POOL_SIZE];
+
+    // start past the end so that the first request triggers a fill
+    static thread_local size_t pool_offset = sizeof(pool);
+
+    // bytes inherited across a fork are shared with the other process: discard them
+    static thread_local uint64_t seen_fork_generation = 0;
+
+    if (seen_fork_generation != fork_generation)
+    {
+        pool_offset = sizeof(pool);
+
+        seen_fork_generation = fork_generation;
+    }
+
+    // large requests bypass the pool and go straight to the OS
+    if (n >= sizeof(pool))
+    {
+        return random_bytes_system(n, buf);
+    }
+
+    if (pool_offset + n > sizeof(pool))
+    {
+        const auto retcode = random_bytes_system(sizeof(pool), pool);
+
+        if (retcode != 0)
+        {
+            return retcode;
+        }
+
+        pool_offset = 0;
+    }
+
+    memcpy(buf, pool + pool_offset, n);
+
+    memset(pool + pool_offset, 0, n);
+
+    pool_offset += n;
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cryptopp/blake2.h>
+#include <cryptopp/sha.h>
+#include <cryptopp/sha3.h>
+#include <helpers/streaming_hasher_t.h>
+
+/**
+ * All of the supported algorithms share the common hashing interface so the
+ * opaque handle in the structure is simply the base transformation type
+ */
+static inline CryptoPP::HashTransformation *transformation(void *context)
+{
+    return static_cast<CryptoPP::HashTransformation *>(context);
+}
+
+streaming_hasher_t::streaming_hasher_t(hash_algorithm_t algorithm)
+{
+    switch (algorithm)
+    {
+        case SHA256:
+            context = new CryptoPP::SHA256();
+
+            break;
+        case SHA384:
+            context = new CryptoPP::SHA384();
+
+            break;
+        case SHA512:
+            context = new CryptoPP::SHA512();
+
+            break;
+        case BLAKE2B:
+            context = new CryptoPP::BLAKE2b(false, 32u);
+
+            break;
+        case SHA3:
+        default:
+            context = new CryptoPP::SHA3_256();
+
+            break;
+    }
+}
+
+streaming_hasher_t::~streaming_hasher_t()
+{
+    delete transformation(context);
+}
+
+crypto_hash_t streaming_hasher_t::finalize()
+{
+    crypto_hash_t result;
+
+    // TruncatedFinal leaves the context restarted and ready for the next message
+    transformation(context)->TruncatedFinal(*result, result.size());
+
+    return result;
+}
+
+crypto_hash_t streaming_hasher_t::finalize_slow(uint64_t iterations)
+{
+    Serialization::serializer_t writer;
+
+    auto result = finalize();
+
+    /**
+     * The key-stretching rounds below match crypto_hash_t::sha3_slow exactly so
+     * that streaming a buffer through this structure produces the same digest
+     * as the single-shot entry point
+     */
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        writer.reset();
+
+        writer.pod(result);
+
+        writer.uint64(i);
+
+        result = crypto_hash_t::sha3(writer.data(), writer.size());
+    }
+
+    return result;
+}
+
+void streaming_hasher_t::reset()
+{
+    transformation(context)->Restart();
+}
+
+void streaming_hasher_t::update(const void *input, size_t length)
+{
+    transformation(context)->Update(static_cast<const CryptoPP::byte *>(input), length);
+}
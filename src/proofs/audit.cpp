@@ -24,18 +24,196 @@
 // STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <atomic>
 #include <crypto_constants.h>
+#include <crypto_parallel.h>
+#include <crypto_stats.h>
 #include <encoding/base58.h>
 #include <helpers/scalar_transcript_t.h>
 #include <proofs/audit.h>
+#include <cstring>
 #include <serialization.h>
+#include <thread>
 #include <signatures/ring_signature_clsag.h>
 
+// the fixed archive layout: an 8-byte magic, a version, and a record count,
+// followed by fixed-stride records of key image || signature scalar || challenge
+static const unsigned char AUDIT_ARCHIVE_MAGIC[8] = {'A', 'U', 'D', 'I', 'T', 'P', 'R', 'F'};
+
+static const uint64_t AUDIT_ARCHIVE_VERSION = 1;
+
+static const size_t AUDIT_ARCHIVE_HEADER_SIZE = sizeof(AUDIT_ARCHIVE_MAGIC) + sizeof(uint64_t) + sizeof(uint64_t);
+
+static const size_t AUDIT_ARCHIVE_RECORD_SIZE = 96;
+
 namespace Crypto::Audit
 {
+    std::tuple<bool, size_t> check_outputs_proof_archive(
+        const std::vector<crypto_public_key_t> &public_ephemerals,
+        const unsigned char *archive,
+        size_t length)
+    {
+        if (length < AUDIT_ARCHIVE_HEADER_SIZE)
+        {
+            return {false, 0};
+        }
+
+        if (std::memcmp(archive, AUDIT_ARCHIVE_MAGIC, sizeof(AUDIT_ARCHIVE_MAGIC)) != 0)
+        {
+            return {false, 0};
+        }
+
+        uint64_t version = 0, count = 0;
+
+        std::memcpy(&version, archive + sizeof(AUDIT_ARCHIVE_MAGIC), sizeof(version));
+
+        std::memcpy(&count, archive + sizeof(AUDIT_ARCHIVE_MAGIC) + sizeof(version), sizeof(count));
+
+        if (version != AUDIT_ARCHIVE_VERSION || count != public_ephemerals.size())
+        {
+            return {false, 0};
+        }
+
+        if (length < AUDIT_ARCHIVE_HEADER_SIZE + (count * AUDIT_ARCHIVE_RECORD_SIZE))
+        {
+            return {false, 0};
+        }
+
+        const auto *records = archive + AUDIT_ARCHIVE_HEADER_SIZE;
+
+        /**
+         * The chained message digests roll out serially (reading the key
+         * images in place from the mapping) before the signature checks fan
+         * out across the worker pool, each reading its record at its fixed
+         * offset with no materialized vectors
+         */
+        std::vector<crypto_hash_t> message_digests(count);
+
+        std::vector<crypto_key_image_t> key_images(count);
+
+        try
+        {
+            auto tr = scalar_transcript_t(OUTPUT_PROOF_DOMAIN);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const auto *record = records + (i * AUDIT_ARCHIVE_RECORD_SIZE);
+
+                key_images[i] = crypto_key_image_t(std::vector<unsigned char>(record, record + 32));
+
+                tr.update(public_ephemerals[i], key_images[i]);
+
+                message_digests[i] = tr.challenge<crypto_hash_t>();
+            }
+        }
+        catch (const std::exception &e)
+        {
+            PRINTF(e.what())
+
+            return {false, 0};
+        }
+
+        std::atomic<size_t> first_failure {SIZE_MAX};
+
+        Crypto::Parallel::parallel_for(
+            0,
+            count,
+            [&](size_t i)
+            {
+                if (first_failure != SIZE_MAX)
+                {
+                    return;
+                }
+
+                const auto *record = records + (i * AUDIT_ARCHIVE_RECORD_SIZE);
+
+                bool passed = false;
+
+                try
+                {
+                    const auto scalar = crypto_scalar_t(std::vector<unsigned char>(record + 32, record + 64));
+
+                    const auto challenge = crypto_scalar_t(std::vector<unsigned char>(record + 64, record + 96));
+
+                    const auto signature =
+                        crypto_clsag_signature_t(std::vector<crypto_scalar_t>(1, scalar), challenge, {}, {});
+
+                    passed = Crypto::RingSignature::CLSAG::check_ring_signature(
+                        message_digests[i], key_images[i], {public_ephemerals[i]}, signature);
+                }
+                catch (const std::exception &e)
+                {
+                    PRINTF(e.what())
+                }
+
+                if (!passed)
+                {
+                    auto observed = first_failure.load();
+
+                    while (i < observed && !first_failure.compare_exchange_weak(observed, i))
+                    {
+                    }
+                }
+            });
+
+        if (first_failure != SIZE_MAX)
+        {
+            return {false, first_failure.load()};
+        }
+
+        return {true, SIZE_MAX};
+    }
+
+    std::tuple<bool, std::vector<uint8_t>>
+        generate_outputs_proof_archive(const std::vector<crypto_scalar_t> &secret_ephemerals)
+    {
+        std::vector<uint8_t> result;
+
+        result.reserve(AUDIT_ARCHIVE_HEADER_SIZE + (secret_ephemerals.size() * AUDIT_ARCHIVE_RECORD_SIZE));
+
+        result.insert(result.end(), AUDIT_ARCHIVE_MAGIC, AUDIT_ARCHIVE_MAGIC + sizeof(AUDIT_ARCHIVE_MAGIC));
+
+        const uint64_t version = AUDIT_ARCHIVE_VERSION, count = secret_ephemerals.size();
+
+        result.resize(result.size() + sizeof(version) + sizeof(count));
+
+        std::memcpy(result.data() + sizeof(AUDIT_ARCHIVE_MAGIC), &version, sizeof(version));
+
+        std::memcpy(result.data() + sizeof(AUDIT_ARCHIVE_MAGIC) + sizeof(version), &count, sizeof(count));
+
+        auto tr = scalar_transcript_t(OUTPUT_PROOF_DOMAIN);
+
+        for (const auto &secret_ephemeral : secret_ephemerals)
+        {
+            const auto public_ephemeral = secret_ephemeral.point();
+
+            const auto key_image = Crypto::generate_key_image(public_ephemeral, secret_ephemeral);
+
+            tr.update(public_ephemeral, key_image);
+
+            const auto [success, signature] = Crypto::RingSignature::CLSAG::generate_ring_signature(
+                tr.challenge<crypto_hash_t>(), secret_ephemeral, {public_ephemeral});
+
+            if (!success || signature.scalars.size() != 1)
+            {
+                return {false, {}};
+            }
+
+            result.insert(result.end(), key_image.data(), key_image.data() + key_image.size());
+
+            result.insert(result.end(), signature.scalars[0].data(), signature.scalars[0].data() + 32);
+
+            result.insert(result.end(), signature.challenge.data(), signature.challenge.data() + 32);
+        }
+
+        return {true, result};
+    }
+
     std::tuple<bool, std::vector<crypto_key_image_t>>
         check_outputs_proof(const std::vector<crypto_public_key_t> &public_ephemerals, const std::string &proof)
     {
+        CRYPTO_TIME_OPERATION("Audit::check_outputs_proof")
+
         // try to decode the information from the Base58 encoded string
         auto [success, reader] = Base58::decode_check(proof);
 
@@ -85,39 +263,186 @@ namespace Crypto::Audit
         return {true, key_images};
     }
 
-    std::tuple<bool, std::string> generate_outputs_proof(const std::vector<crypto_scalar_t> &secret_ephemerals)
+    std::tuple<bool, std::vector<crypto_key_image_t>, size_t> check_outputs_proof_parallel(
+        const std::vector<crypto_public_key_t> &public_ephemerals,
+        const std::string &proof,
+        bool early_exit)
     {
-        std::vector<crypto_public_key_t> public_ephemerals;
+        CRYPTO_TIME_OPERATION("Audit::check_outputs_proof_parallel")
 
-        std::vector<crypto_key_image_t> key_images;
+        // try to decode the information from the Base58 encoded string
+        auto [success, reader] = Base58::decode_check(proof);
+
+        if (!success)
+        {
+            return {false, {}, 0};
+        }
 
+        // extract the key images
+        const auto key_images = reader.podV<crypto_key_image_t>();
+
+        // extract the signatures
         std::vector<crypto_clsag_signature_t> signatures;
 
-        auto tr = scalar_transcript_t(OUTPUT_PROOF_DOMAIN);
+        {
+            const auto count = reader.varint<uint64_t>();
 
-        // loop through the secret keys provided and generate the proofs
-        for (const auto &secret_ephemeral : secret_ephemerals)
+            for (size_t i = 0; i < count; ++i)
+            {
+                signatures.emplace_back(reader);
+            }
+        }
+
+        // verify that we have the proper count of key images and signatures for the public ephemerals we provided
+        if (public_ephemerals.size() != key_images.size() || key_images.size() != signatures.size())
         {
-            const auto public_ephemeral = secret_ephemeral.point();
+            return {false, {}, 0};
+        }
 
-            const auto key_image = Crypto::generate_key_image(public_ephemeral, secret_ephemeral);
+        /**
+         * The per-output message digests chain through one transcript so they
+         * are rolled out serially (cheap scalar hashing) before the expensive
+         * signature checks fan out across the worker pool
+         */
+        std::vector<crypto_hash_t> message_digests(signatures.size());
 
-            key_images.push_back(key_image);
+        {
+            auto tr = scalar_transcript_t(OUTPUT_PROOF_DOMAIN);
 
-            // building the transcript in this way (for the message digest) guarantees proper ordering
-            tr.update(public_ephemeral, key_image);
+            for (size_t i = 0; i < signatures.size(); ++i)
+            {
+                tr.update(public_ephemerals[i], key_images[i]);
+
+                message_digests[i] = tr.challenge<crypto_hash_t>();
+            }
+        }
+
+        std::atomic<size_t> first_failure {SIZE_MAX};
+
+        Crypto::Parallel::parallel_for(
+            0,
+            signatures.size(),
+            [&](size_t i)
+            {
+                // in early-exit mode a failure anywhere stops the remaining work
+                if (early_exit && first_failure != SIZE_MAX)
+                {
+                    return;
+                }
+
+                if (!Crypto::RingSignature::CLSAG::check_ring_signature(
+                        message_digests[i], key_images[i], {public_ephemerals[i]}, signatures[i]))
+                {
+                    // record the earliest failing index
+                    auto observed = first_failure.load();
+
+                    while (i < observed && !first_failure.compare_exchange_weak(observed, i))
+                    {
+                    }
+                }
+            });
+
+        if (first_failure != SIZE_MAX)
+        {
+            return {false, {}, first_failure.load()};
+        }
+
+        return {true, key_images, SIZE_MAX};
+    }
+
+    std::tuple<bool, std::string>
+        generate_outputs_proof(const std::vector<crypto_scalar_t> &secret_ephemerals, size_t threads)
+    {
+        if (threads == 0)
+        {
+            threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+
+        std::vector<crypto_public_key_t> public_ephemerals(secret_ephemerals.size());
+
+        std::vector<crypto_key_image_t> key_images(secret_ephemerals.size());
+
+        std::vector<crypto_clsag_signature_t> signatures(secret_ephemerals.size());
+
+        /**
+         * The generation pipelines into three phases: the per-output key
+         * material fans out across the pool, the message digest chain (which
+         * is strictly ordered by construction) rolls out serially, and the
+         * independent signatures fan out again -- every phase fills its slot
+         * by index so the emitted proof ordering is identical to the serial
+         * walk
+         */
+        const auto derive_keys = [&](size_t i)
+        {
+            public_ephemerals[i] = secret_ephemerals[i].point();
+
+            key_images[i] = Crypto::generate_key_image(public_ephemerals[i], secret_ephemerals[i]);
+        };
+
+        if (threads > 1)
+        {
+            Crypto::Parallel::parallel_for(0, secret_ephemerals.size(), derive_keys);
+        }
+        else
+        {
+            for (size_t i = 0; i < secret_ephemerals.size(); ++i)
+            {
+                derive_keys(i);
+            }
+        }
+
+        std::vector<crypto_hash_t> message_digests(secret_ephemerals.size());
+
+        {
+            auto tr = scalar_transcript_t(OUTPUT_PROOF_DOMAIN);
+
+            for (size_t i = 0; i < secret_ephemerals.size(); ++i)
+            {
+                // building the transcript in this way (for the message digest) guarantees proper ordering
+                tr.update(public_ephemerals[i], key_images[i]);
+
+                message_digests[i] = tr.challenge<crypto_hash_t>();
+            }
+        }
+
+        std::atomic<bool> failed {false};
+
+        const auto sign_output = [&](size_t i)
+        {
+            if (failed)
+            {
+                return;
+            }
 
-            // generate the signature using the key image generated
             const auto [success, signature] = Crypto::RingSignature::CLSAG::generate_ring_signature(
-                tr.challenge<crypto_hash_t>(), secret_ephemeral, {public_ephemeral});
+                message_digests[i], secret_ephemerals[i], {public_ephemerals[i]});
 
             // if signature generation failed, something went terribly wrong
             if (!success)
             {
-                return {false, std::string()};
+                failed = true;
+
+                return;
+            }
+
+            signatures[i] = signature;
+        };
+
+        if (threads > 1)
+        {
+            Crypto::Parallel::parallel_for(0, secret_ephemerals.size(), sign_output);
+        }
+        else
+        {
+            for (size_t i = 0; i < secret_ephemerals.size(); ++i)
+            {
+                sign_output(i);
             }
+        }
 
-            signatures.push_back(signature);
+        if (failed)
+        {
+            return {false, std::string()};
         }
 
         // package up the information
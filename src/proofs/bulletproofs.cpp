@@ -28,10 +28,15 @@
 // https://github.com/SarangNoether/skunkworks/tree/pybullet
 
 #include <crypto_constants.h>
+#include <crypto_parallel.h>
+#include <crypto_stats.h>
+#include <helpers/multiexp.h>
 #include <helpers/scalar_transcript_t.h>
 #include <mutex>
 #include <proofs/bulletproofs.h>
 #include <proofs/ringct.h>
+#include <thread>
+#include <types/crypto_span_t.h>
 
 static const auto powers_of_two = Crypto::TWO.pow_expand(64);
 
@@ -52,6 +57,22 @@ static std::tuple<crypto_point_vector_t, crypto_point_vector_t> generate_exponen
 
     static crypto_point_vector_t L_cached, R_cached;
 
+#ifdef CRYPTO_USE_GENERATED_CONSTANTS
+    /**
+     * Seed the cache from the baked generator tables the first time through so
+     * that the typical proof sizes never pay to hash a generator at runtime
+     */
+    if (L_cached.empty())
+    {
+        for (size_t i = 0; i < BAKED_GENERATOR_COUNT; ++i)
+        {
+            L_cached.append(crypto_point_t(BULLETPROOFS_GENERATORS_L[i]));
+
+            R_cached.append(crypto_point_t(BULLETPROOFS_GENERATORS_R[i]));
+        }
+    }
+#endif
+
     if (count == L_cached.size() && count == R_cached.size())
     {
         return {L_cached, R_cached};
@@ -84,6 +105,20 @@ static std::tuple<crypto_point_vector_t, crypto_point_vector_t> generate_exponen
 
 namespace Crypto::RangeProofs::Bulletproofs
 {
+    void preload_generators(size_t count)
+    {
+        const auto [Gi, Hi] = generate_exponents(count);
+
+        // the generators are known-good constants; intern them so validation
+        // of their encodings short-circuits everywhere
+        for (size_t i = 0; i < count; ++i)
+        {
+            Crypto::register_constant_point(Gi[i]);
+
+            Crypto::register_constant_point(Hi[i]);
+        }
+    }
+
     /**
      * Helps to calculate an inner product round
      */
@@ -95,8 +130,15 @@ namespace Crypto::RangeProofs::Bulletproofs
             const crypto_point_t &U,
             crypto_scalar_vector_t a,
             crypto_scalar_vector_t b,
-            scalar_transcript_t tr):
-            G(std::move(G)), H(std::move(H)), U(U), a(std::move(a)), b(std::move(b)), tr(std::move(tr))
+            scalar_transcript_t tr,
+            size_t threads = 1):
+            G(std::move(G)),
+            H(std::move(H)),
+            U(U),
+            a(std::move(a)),
+            b(std::move(b)),
+            tr(std::move(tr)),
+            threads(threads)
         {
         }
 
@@ -117,19 +159,48 @@ namespace Crypto::RangeProofs::Bulletproofs
             {
                 n /= 2;
 
-                const auto a1 = a.slice(0, n), a2 = a.slice(n, a.size());
+                /**
+                 * The halves are zero-copy views straight into the proving
+                 * vectors; nothing is copied until an operation produces an
+                 * owning result
+                 */
+                const auto a1 = scalar_span_t(a).slice(0, n), a2 = scalar_span_t(a).slice(n, a.size());
 
-                const auto b1 = b.slice(0, n), b2 = b.slice(n, b.size());
+                const auto b1 = scalar_span_t(b).slice(0, n), b2 = scalar_span_t(b).slice(n, b.size());
 
-                const auto G1 = G.slice(0, n), G2 = G.slice(n, G.size());
+                const auto G1 = point_span_t(G).slice(0, n), G2 = point_span_t(G).slice(n, G.size());
 
-                const auto H1 = H.slice(0, n), H2 = H.slice(n, H.size());
+                const auto H1 = point_span_t(H).slice(0, n), H2 = point_span_t(H).slice(n, H.size());
 
                 const auto cL = a1.inner_product(b2), cR = a2.inner_product(b1);
 
-                L.append(Crypto::INV_EIGHT * (a1.inner_product(G2) + b2.inner_product(H1) + (cL * U)));
+                /**
+                 * The two halves of the fold are entirely independent so when a
+                 * parallel prove was requested the L side runs on a worker
+                 * while the R side runs on the calling thread
+                 */
+                crypto_point_t L_round, R_round;
 
-                R.append(Crypto::INV_EIGHT * (a2.inner_product(G1) + b1.inner_product(H2) + (cR * U)));
+                const auto compute_L = [&]()
+                { L_round = Crypto::INV_EIGHT * (a1.inner_product(G2) + b2.inner_product(H1) + (cL * U)); };
+
+                const auto compute_R = [&]()
+                { R_round = Crypto::INV_EIGHT * (a2.inner_product(G1) + b1.inner_product(H2) + (cR * U)); };
+
+                if (threads > 1)
+                {
+                    Crypto::Parallel::parallel_invoke(compute_L, compute_R);
+                }
+                else
+                {
+                    compute_L();
+
+                    compute_R();
+                }
+
+                L.append(L_round);
+
+                R.append(R_round);
 
                 tr.update(L.back());
 
@@ -142,13 +213,25 @@ namespace Crypto::RangeProofs::Bulletproofs
                     throw std::runtime_error("x cannot be zero");
                 }
 
-                G = G1.dbl_mult(x.invert(), G2, x);
+                // the round challenge feeds four terms below so invert it exactly once
+                const auto x_inv = x.invert();
 
-                H = H1.dbl_mult(x, H2, x.invert());
+                // the G and H updates are likewise independent of one another
+                if (threads > 1)
+                {
+                    Crypto::Parallel::parallel_invoke(
+                        [&]() { G = G1.dbl_mult(x_inv, G2, x); }, [&]() { H = H1.dbl_mult(x, H2, x_inv); });
+                }
+                else
+                {
+                    G = G1.dbl_mult(x_inv, G2, x);
+
+                    H = H1.dbl_mult(x, H2, x_inv);
+                }
 
-                a = (a1 * x) + (a2 * x.invert());
+                a = (a1 * x) + (a2 * x_inv);
 
-                b = (b1 * x.invert()) + (b2 * x);
+                b = (b1 * x_inv) + (b2 * x);
             }
 
             done = true;
@@ -163,18 +246,29 @@ namespace Crypto::RangeProofs::Bulletproofs
         crypto_point_t U;
         crypto_point_vector_t L, R;
         crypto_scalar_vector_t a, b;
+        size_t threads = 1;
     };
 
     std::tuple<crypto_bulletproof_t, std::vector<crypto_pedersen_commitment_t>> prove(
         const std::vector<uint64_t> &amounts,
         const std::vector<crypto_blinding_factor_t> &blinding_factors,
-        size_t N)
+        size_t N,
+        size_t threads)
     {
+        CRYPTO_STATS_COUNT(range_proof_operations)
+
+        CRYPTO_TIME_OPERATION("Bulletproofs::prove")
+
         if (N == 0)
         {
             throw std::range_error("N must be at least 1-bit");
         }
 
+        if (threads == 0)
+        {
+            threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+
         if (N > 64)
         {
             throw std::range_error("N must not exceed 64-bits");
@@ -208,18 +302,27 @@ namespace Crypto::RangeProofs::Bulletproofs
 
         crypto_point_vector_t V;
 
-        crypto_scalar_vector_t aL, aR;
+        /**
+         * The witness planes decompose in one pass: every amount's bits land
+         * directly in their aL/aR slots (aR is simply bit minus one, i.e. zero
+         * or minus one) with the storage sized once up front
+         */
+        crypto_scalar_vector_t aL(MN), aR(MN);
+
+        const auto minus_one = Crypto::ZERO - Crypto::ONE;
 
         for (size_t i = 0; i < M; ++i)
         {
             V.append(Crypto::RingCT::generate_pedersen_commitment(blinding_factors[i], amounts[i]));
 
-            aL.extend(crypto_scalar_t(amounts[i]).to_bits(N));
-        }
+            for (size_t bit = 0; bit < N; ++bit)
+            {
+                const bool set = ((amounts[i] >> bit) & 1) != 0;
 
-        for (const auto &bit : aL.container)
-        {
-            aR.append(bit - Crypto::ONE);
+                aL[(i * N) + bit] = set ? Crypto::ONE : Crypto::ZERO;
+
+                aR[(i * N) + bit] = set ? Crypto::ZERO : minus_one;
+            }
         }
 
     retry:
@@ -363,7 +466,7 @@ namespace Crypto::RangeProofs::Bulletproofs
         // we try here as if we fail the challenge in the inner product round then we need to try again
         try
         {
-            const auto [L, R, a, b] = InnerProductRound(Gi, Hi_points, Hx_ip, l, r, tr).compute();
+            const auto [L, R, a, b] = InnerProductRound(Gi, Hi_points, Hx_ip, l, r, tr, threads).compute();
 
             return {crypto_bulletproof_t(A, S, T1, T2, taux, mu, L, R, a, b, t), V.container};
         }
@@ -380,6 +483,10 @@ namespace Crypto::RangeProofs::Bulletproofs
         const std::vector<std::vector<crypto_pedersen_commitment_t>> &commitments,
         size_t N)
     {
+        CRYPTO_STATS_COUNT(range_proof_operations)
+
+        CRYPTO_TIME_OPERATION("Bulletproofs::verify")
+
         if (N == 0)
         {
             throw std::range_error("N must be at least 1-bit");
@@ -408,13 +515,29 @@ namespace Crypto::RangeProofs::Bulletproofs
 
         const auto [Gi, Hi] = generate_exponents(max_MN);
 
+        // constant for every proof in the batch so compute it exactly once
+        const auto two_pow_sum = Crypto::TWO.pow_sum(N);
+
         auto y0 = Crypto::ZERO, y1 = Crypto::ZERO, z1 = Crypto::ZERO, z3 = Crypto::ZERO;
 
-        std::vector<crypto_scalar_t> Gi_scalars(max_MN, Crypto::ZERO), Hi_scalars(max_MN, Crypto::ZERO);
+        /**
+         * The working vectors are per-thread scratch reset (capacity retained)
+         * at every call, so a validator verifying similar batch shapes back to
+         * back reaches steady state with zero allocations here
+         */
+        static thread_local std::vector<crypto_scalar_t> Gi_scalars, Hi_scalars;
+
+        static thread_local crypto_scalar_vector_t scalars;
+
+        static thread_local crypto_point_vector_t points;
+
+        Gi_scalars.assign(max_MN, Crypto::ZERO);
 
-        crypto_scalar_vector_t scalars;
+        Hi_scalars.assign(max_MN, Crypto::ZERO);
 
-        crypto_point_vector_t points;
+        scalars.container.clear();
+
+        points.container.clear();
 
         // loop through all of the proofs in the batch
         for (size_t ii = 0; ii < proofs.size(); ++ii)
@@ -497,7 +620,7 @@ namespace Crypto::RangeProofs::Bulletproofs
 
             for (size_t j = 1; j < M + 1; ++j)
             {
-                k -= (z_powers[j + 2] * Crypto::TWO.pow_sum(N));
+                k -= (z_powers[j + 2] * two_pow_sum);
             }
 
             y1 += (proof.t - k) * weight_y;
@@ -506,12 +629,12 @@ namespace Crypto::RangeProofs::Bulletproofs
             {
                 scalars.append(z_powers[j + 2] * weight_y);
 
-                points.append(Crypto::EIGHT * commitments[ii][j]);
+                points.append(commitments[ii][j].mul8());
             }
 
             scalars.append(x * weight_y);
 
-            points.append(Crypto::EIGHT * proof.T1);
+            points.append(proof.T1.mul8());
 
             if (!points.back().valid())
             {
@@ -520,7 +643,7 @@ namespace Crypto::RangeProofs::Bulletproofs
 
             scalars.append(x.squared() * weight_y);
 
-            points.append(Crypto::EIGHT * proof.T2);
+            points.append(proof.T2.mul8());
 
             if (!points.back().valid())
             {
@@ -529,7 +652,7 @@ namespace Crypto::RangeProofs::Bulletproofs
 
             scalars.append(weight_z);
 
-            points.append(Crypto::EIGHT * proof.A);
+            points.append(proof.A.mul8());
 
             if (!points.back().valid())
             {
@@ -538,7 +661,7 @@ namespace Crypto::RangeProofs::Bulletproofs
 
             scalars.append(x * weight_z);
 
-            points.append(Crypto::EIGHT * proof.S);
+            points.append(proof.S.mul8());
 
             if (!points.back().valid())
             {
@@ -610,7 +733,7 @@ namespace Crypto::RangeProofs::Bulletproofs
             {
                 scalars.append(challenges[i].squared() * weight_z);
 
-                points.append(Crypto::EIGHT * proof.L[i]);
+                points.append(proof.L[i].mul8());
 
                 if (!points.back().valid())
                 {
@@ -619,7 +742,7 @@ namespace Crypto::RangeProofs::Bulletproofs
 
                 scalars.append(challenges_inv[i].squared() * weight_z);
 
-                points.append(Crypto::EIGHT * proof.R[i]);
+                points.append(proof.R[i].mul8());
 
                 if (!points.back().valid())
                 {
@@ -640,16 +763,27 @@ namespace Crypto::RangeProofs::Bulletproofs
 
         for (size_t i = 0; i < max_MN; ++i)
         {
-            scalars.append(Gi_scalars[i].negate());
+            Gi_scalars[i] = Gi_scalars[i].negate();
 
-            points.append(Gi[i]);
+            Hi_scalars[i] = Hi_scalars[i].negate();
+        }
 
-            scalars.append(Hi_scalars[i].negate());
+        /**
+         * Every term of every proof has been folded into a single random
+         * linear combination: the dynamic terms evaluate through the general
+         * engine while the generator planes walk dense cache-aware tables of
+         * their cached forms, and the batch stands or falls on the combined
+         * result being the identity
+         */
+        auto result = scalars.inner_product(points);
 
-            points.append(Hi[i]);
-        }
+        const auto Gi_table = generator_table_t(Gi.container), Hi_table = generator_table_t(Hi.container);
+
+        result += Crypto::multiexp(Gi_scalars, Gi_table);
+
+        result += Crypto::multiexp(Hi_scalars, Hi_table);
 
-        return scalars.inner_product(points).empty();
+        return result.is_identity();
     }
 
     bool verify(
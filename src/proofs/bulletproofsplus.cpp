@@ -28,9 +28,14 @@
 // https://github.com/SarangNoether/skunkworks/tree/pybullet-plus
 
 #include <crypto_constants.h>
+#include <crypto_parallel.h>
+#include <crypto_stats.h>
+#include <helpers/multiexp.h>
 #include <helpers/scalar_transcript_t.h>
 #include <mutex>
 #include <proofs/bulletproofsplus.h>
+#include <thread>
+#include <types/crypto_span_t.h>
 #include <proofs/ringct.h>
 
 static const auto powers_of_two = Crypto::TWO.pow_expand(64);
@@ -52,6 +57,22 @@ static std::tuple<crypto_point_vector_t, crypto_point_vector_t> generate_exponen
 
     static crypto_point_vector_t L_cached, R_cached;
 
+#ifdef CRYPTO_USE_GENERATED_CONSTANTS
+    /**
+     * Seed the cache from the baked generator tables the first time through so
+     * that the typical proof sizes never pay to hash a generator at runtime
+     */
+    if (L_cached.empty())
+    {
+        for (size_t i = 0; i < BAKED_GENERATOR_COUNT; ++i)
+        {
+            L_cached.append(crypto_point_t(BULLETPROOFS_PLUS_GENERATORS_L[i]));
+
+            R_cached.append(crypto_point_t(BULLETPROOFS_PLUS_GENERATORS_R[i]));
+        }
+    }
+#endif
+
     if (count == L_cached.size() && count == R_cached.size())
     {
         return {L_cached, R_cached};
@@ -84,6 +105,65 @@ static std::tuple<crypto_point_vector_t, crypto_point_vector_t> generate_exponen
 
 namespace Crypto::RangeProofs::BulletproofsPlus
 {
+    void preload_generators(size_t count)
+    {
+        const auto [Gi, Hi] = generate_exponents(count);
+
+        // the generators are known-good constants; intern them so validation
+        // of their encodings short-circuits everywhere
+        for (size_t i = 0; i < count; ++i)
+        {
+            Crypto::register_constant_point(Gi[i]);
+
+            Crypto::register_constant_point(Hi[i]);
+        }
+    }
+
+    verifier_t::verifier_t(size_t N): bits(N) {}
+
+    bool verifier_t::add(
+        const crypto_bulletproof_plus_t &proof,
+        const std::vector<crypto_pedersen_commitment_t> &commitments)
+    {
+        // the cheap structural work happens up front so junk never sits in the queue
+        if (commitments.empty() || !proof.check_construction())
+        {
+            return false;
+        }
+
+        proofs.push_back(proof);
+
+        commitment_sets.push_back(commitments);
+
+        return true;
+    }
+
+    bool verifier_t::empty() const
+    {
+        return proofs.empty();
+    }
+
+    bool verifier_t::flush(size_t threads)
+    {
+        if (proofs.empty())
+        {
+            return true;
+        }
+
+        const auto result = verify(proofs, commitment_sets, bits, threads);
+
+        proofs.clear();
+
+        commitment_sets.clear();
+
+        return result;
+    }
+
+    size_t verifier_t::size() const
+    {
+        return proofs.size();
+    }
+
     /**
      * Helps to calculate an inner product round
      */
@@ -96,14 +176,16 @@ namespace Crypto::RangeProofs::BulletproofsPlus
             crypto_scalar_vector_t b,
             const crypto_scalar_t &alpha,
             const crypto_scalar_t &y,
-            scalar_transcript_t tr):
+            scalar_transcript_t tr,
+            size_t threads = 1):
             Gi(std::move(Gi)),
             Hi(std::move(Hi)),
             a(std::move(a)),
             b(std::move(b)),
             alpha(alpha),
             y(y),
-            tr(std::move(tr))
+            tr(std::move(tr)),
+            threads(threads)
         {
         }
 
@@ -124,17 +206,25 @@ namespace Crypto::RangeProofs::BulletproofsPlus
 
             auto n = Gi.size();
 
+            // y is fixed for every round so one inversion covers the whole fold
+            const auto y_inv = y.invert();
+
             while (n > 1)
             {
                 n /= 2;
 
-                const auto a1 = a.slice(0, n), a2 = a.slice(n, a.size());
+                /**
+                 * The halves are zero-copy views straight into the proving
+                 * vectors; nothing is copied until an operation produces an
+                 * owning result
+                 */
+                const auto a1 = scalar_span_t(a).slice(0, n), a2 = scalar_span_t(a).slice(n, a.size());
 
-                const auto b1 = b.slice(0, n), b2 = b.slice(n, b.size());
+                const auto b1 = scalar_span_t(b).slice(0, n), b2 = scalar_span_t(b).slice(n, b.size());
 
-                const auto G1 = Gi.slice(0, n), G2 = Gi.slice(n, Gi.size());
+                const auto G1 = point_span_t(Gi).slice(0, n), G2 = point_span_t(Gi).slice(n, Gi.size());
 
-                const auto H1 = Hi.slice(0, n), H2 = Hi.slice(n, Hi.size());
+                const auto H1 = point_span_t(Hi).slice(0, n), H2 = point_span_t(Hi).slice(n, Hi.size());
 
                 const auto dL = crypto_scalar_t::random(), dR = crypto_scalar_t::random();
 
@@ -145,18 +235,51 @@ namespace Crypto::RangeProofs::BulletproofsPlus
 
                 const auto cL = weighted_inner_product(a1, b2, y);
 
-                const auto cR = weighted_inner_product(a2 * y.pow(n), b1, y);
+                const auto a2y = a2 * y.pow(n);
+
+                const auto cR = weighted_inner_product(a2y, b1, y);
+
+                const auto ypow = y.pow(n), yinvpow = y_inv.pow(n);
+
+                /**
+                 * The two halves of the fold are entirely independent so when a
+                 * parallel prove was requested the L side runs on a worker
+                 * while the R side runs on the calling thread
+                 */
+                crypto_point_t L_round, R_round;
+
+                const auto compute_L = [&]()
+                {
+                    const auto a1y = a1 * yinvpow;
 
-                const auto ypow = y.pow(n), yinvpow = y.invert().pow(n);
+                    L_round = Crypto::INV_EIGHT
+                              * (scalar_span_t(a1y).inner_product(G2) + b2.inner_product(H1)
+                                 + cL.dbl_mult(Crypto::H, dL, Crypto::G));
+                };
+
+                const auto compute_R = [&]()
+                {
+                    const auto a2yp = a2 * ypow;
+
+                    R_round = Crypto::INV_EIGHT
+                              * (scalar_span_t(a2yp).inner_product(G1) + b1.inner_product(H2)
+                                 + cR.dbl_mult(Crypto::H, dR, Crypto::G));
+                };
+
+                if (threads > 1)
+                {
+                    Crypto::Parallel::parallel_invoke(compute_L, compute_R);
+                }
+                else
+                {
+                    compute_L();
+
+                    compute_R();
+                }
 
-                L.append(
-                    Crypto::INV_EIGHT
-                    * ((a1 * yinvpow).inner_product(G2) + b2.inner_product(H1)
-                       + cL.dbl_mult(Crypto::H, dL, Crypto::G)));
+                L.append(L_round);
 
-                R.append(
-                    Crypto::INV_EIGHT
-                    * ((a2 * ypow).inner_product(G1) + b1.inner_product(H2) + cR.dbl_mult(Crypto::H, dR, Crypto::G)));
+                R.append(R_round);
 
                 tr.update(L.back());
 
@@ -169,15 +292,28 @@ namespace Crypto::RangeProofs::BulletproofsPlus
                     throw std::runtime_error("x cannot be zero");
                 }
 
-                Gi = G1.dbl_mult(x.invert(), G2, (x * yinvpow));
+                // the round challenge feeds five terms below so invert it exactly once
+                const auto x_inv = x.invert();
 
-                Hi = H1.dbl_mult(x, H2, x.invert());
+                // the Gi and Hi updates are likewise independent of one another
+                if (threads > 1)
+                {
+                    Crypto::Parallel::parallel_invoke(
+                        [&]() { Gi = G1.dbl_mult(x_inv, G2, (x * yinvpow)); },
+                        [&]() { Hi = H1.dbl_mult(x, H2, x_inv); });
+                }
+                else
+                {
+                    Gi = G1.dbl_mult(x_inv, G2, (x * yinvpow));
+
+                    Hi = H1.dbl_mult(x, H2, x_inv);
+                }
 
-                a = (a1 * x) + (a2 * (ypow * x.invert()));
+                a = (a1 * x) + (a2 * (ypow * x_inv));
 
-                b = (b1 * x.invert()) + (b2 * x);
+                b = (b1 * x_inv) + (b2 * x);
 
-                alpha = (dL * x.squared()) + alpha + (dR * x.invert().squared());
+                alpha = (dL * x.squared()) + alpha + (dR * x_inv.squared());
             }
 
         try_again:
@@ -191,7 +327,12 @@ namespace Crypto::RangeProofs::BulletproofsPlus
 
             const auto rybsya = (r * y * b[0]) + (s * y * a[0]);
 
-            A = Crypto::INV_EIGHT * (r.dbl_mult(Gi[0], s, Hi[0]) + rybsya.dbl_mult(Crypto::H, d, Crypto::G));
+            // all four terms fuse into a single interleaved multiplication
+            const crypto_scalar_t A_scalars[4] = {r, s, rybsya, d};
+
+            const crypto_point_t A_points[4] = {Gi[0], Hi[0], Crypto::H, Crypto::G};
+
+            A = Crypto::INV_EIGHT * Crypto::multi_mult(A_scalars, A_points, 4);
 
             B = Crypto::INV_EIGHT * (r * y * s).dbl_mult(Crypto::H, eta, Crypto::G);
 
@@ -219,8 +360,8 @@ namespace Crypto::RangeProofs::BulletproofsPlus
 
       private:
         static crypto_scalar_t weighted_inner_product(
-            const crypto_scalar_vector_t &a,
-            const crypto_scalar_vector_t &b,
+            const scalar_span_t &a,
+            const scalar_span_t &b,
             const crypto_scalar_t &y)
         {
             if (a.size() != b.size())
@@ -230,8 +371,19 @@ namespace Crypto::RangeProofs::BulletproofsPlus
 
             auto r = Crypto::ZERO;
 
+            /**
+             * The weight rolls forward one multiplication per element instead
+             * of a full exponentiation per element, and the products fuse into
+             * the accumulator in the same pass
+             */
+            auto ypow = y;
+
             for (size_t i = 0; i < a.size(); ++i)
-                r += a[i] * y.pow(i + 1) * b[i];
+            {
+                r += a[i] * ypow * b[i];
+
+                ypow *= y;
+            }
 
             return r;
         }
@@ -242,18 +394,29 @@ namespace Crypto::RangeProofs::BulletproofsPlus
         crypto_point_t A, B;
         crypto_scalar_vector_t a, b;
         crypto_scalar_t alpha, y, r1, s1, d1;
+        size_t threads = 1;
     };
 
     std::tuple<crypto_bulletproof_plus_t, std::vector<crypto_pedersen_commitment_t>> prove(
         const std::vector<uint64_t> &amounts,
         const std::vector<crypto_blinding_factor_t> &blinding_factors,
-        size_t N)
+        size_t N,
+        size_t threads)
     {
+        CRYPTO_STATS_COUNT(range_proof_operations)
+
+        CRYPTO_TIME_OPERATION("BulletproofsPlus::prove")
+
         if (N == 0)
         {
             throw std::range_error("N must be at least 1-bit");
         }
 
+        if (threads == 0)
+        {
+            threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+
         if (N > 64)
         {
             throw std::range_error("N must not exceed 64-bits");
@@ -289,16 +452,29 @@ namespace Crypto::RangeProofs::BulletproofsPlus
 
         crypto_point_vector_t V;
 
-        crypto_scalar_vector_t aL, aR;
+        /**
+         * The witness planes decompose in one pass: every amount's bits land
+         * directly in their aL/aR slots (aR is simply bit minus one, i.e. zero
+         * or minus one) with the storage sized once up front, instead of
+         * growing per-amount bit vectors and then subtracting a ones vector
+         */
+        crypto_scalar_vector_t aL(MN), aR(MN);
+
+        const auto minus_one = Crypto::ZERO - Crypto::ONE;
 
         for (size_t i = 0; i < M; ++i)
         {
             V.append(Crypto::RingCT::generate_pedersen_commitment(blinding_factors[i], amounts[i]));
 
-            aL.extend(crypto_scalar_t(amounts[i]).to_bits(N));
-        }
+            for (size_t bit = 0; bit < N; ++bit)
+            {
+                const bool set = ((amounts[i] >> bit) & 1) != 0;
+
+                aL[(i * N) + bit] = set ? Crypto::ONE : Crypto::ZERO;
 
-        aR = aL - one_MN;
+                aR[(i * N) + bit] = set ? Crypto::ZERO : minus_one;
+            }
+        }
 
     try_again:
         scalar_transcript_t tr(BULLETPROOFS_PLUS_DOMAIN_0);
@@ -360,7 +536,8 @@ namespace Crypto::RangeProofs::BulletproofsPlus
         // we try here as if we fail the challenge in the inner product round then we need to try again
         try
         {
-            const auto [A1, B, r1, s1, d1, L, R] = InnerProductRound(Gi, Hi, aL1, aR1, alpha1, y, tr).compute();
+            const auto [A1, B, r1, s1, d1, L, R] =
+                InnerProductRound(Gi, Hi, aL1, aR1, alpha1, y, tr, threads).compute();
 
             return {crypto_bulletproof_plus_t(A, A1, B, r1, s1, d1, L, R), V.container};
         }
@@ -372,11 +549,24 @@ namespace Crypto::RangeProofs::BulletproofsPlus
         }
     }
 
+    std::future<std::tuple<crypto_bulletproof_plus_t, std::vector<crypto_pedersen_commitment_t>>> prove_async(
+        const std::vector<uint64_t> &amounts,
+        const std::vector<crypto_blinding_factor_t> &blinding_factors,
+        size_t N)
+    {
+        return Crypto::Parallel::async([amounts, blinding_factors, N]() { return prove(amounts, blinding_factors, N); });
+    }
+
     bool verify(
         const std::vector<crypto_bulletproof_plus_t> &proofs,
         const std::vector<std::vector<crypto_pedersen_commitment_t>> &commitments,
-        size_t N)
+        size_t N,
+        size_t threads)
     {
+        CRYPTO_STATS_COUNT(range_proof_operations)
+
+        CRYPTO_TIME_OPERATION("BulletproofsPlus::verify")
+
         if (N == 0)
         {
             throw std::range_error("N must be at least 1-bit");
@@ -392,6 +582,54 @@ namespace Crypto::RangeProofs::BulletproofsPlus
             return false;
         }
 
+        if (threads == 0)
+        {
+            threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+
+        /**
+         * If a parallel verification was requested and the batch is large enough to
+         * split, partition the proofs into per-thread chunks whereby each chunk is
+         * folded into its own weighted multiexp on a worker thread and the batch
+         * succeeds only if every chunk verifies
+         */
+        if (threads > 1 && proofs.size() > 1)
+        {
+            const auto chunk_count = std::min(threads, proofs.size());
+
+            const auto chunk_size = (proofs.size() + chunk_count - 1) / chunk_count;
+
+            std::vector<unsigned char> results(chunk_count, 0);
+
+            Crypto::Parallel::parallel_for(
+                0,
+                chunk_count,
+                [&proofs, &commitments, &results, N, chunk_size](size_t chunk)
+                {
+                    const auto start = chunk * chunk_size;
+
+                    const auto end = std::min(start + chunk_size, proofs.size());
+
+                    const auto chunk_proofs =
+                        std::vector<crypto_bulletproof_plus_t>(proofs.begin() + start, proofs.begin() + end);
+
+                    const auto chunk_commitments = std::vector<std::vector<crypto_pedersen_commitment_t>>(
+                        commitments.begin() + start, commitments.begin() + end);
+
+                    results[chunk] = verify(chunk_proofs, chunk_commitments, N, 1) ? 1 : 0;
+                });
+
+            for (const auto &result : results)
+            {
+                if (result == 0)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
         N = Crypto::pow2_round(N);
 
         size_t max_M = 0;
@@ -407,11 +645,22 @@ namespace Crypto::RangeProofs::BulletproofsPlus
 
         auto G_scalar = Crypto::ZERO, H_scalar = Crypto::ZERO;
 
-        crypto_scalar_vector_t Gi_scalars(max_MN, Crypto::ZERO), Hi_scalars(max_MN, Crypto::ZERO);
+        /**
+         * The working vectors are per-thread scratch reset (capacity retained)
+         * at every call, so a validator verifying similar batch shapes back to
+         * back reaches steady state with zero allocations here
+         */
+        static thread_local crypto_scalar_vector_t Gi_scalars, Hi_scalars, scalars;
+
+        static thread_local crypto_point_vector_t points;
+
+        Gi_scalars.container.assign(max_MN, Crypto::ZERO);
 
-        crypto_scalar_vector_t scalars;
+        Hi_scalars.container.assign(max_MN, Crypto::ZERO);
 
-        crypto_point_vector_t points;
+        scalars.container.clear();
+
+        points.container.clear();
 
         for (size_t ii = 0; ii < proofs.size(); ++ii)
         {
@@ -433,8 +682,6 @@ namespace Crypto::RangeProofs::BulletproofsPlus
 
             const auto MN = M * N;
 
-            const auto one_MN = crypto_scalar_vector_t(MN, Crypto::ONE);
-
             const auto weight = crypto_scalar_t::random();
 
             tr.update(commitments[ii]);
@@ -511,11 +758,20 @@ namespace Crypto::RangeProofs::BulletproofsPlus
             // value is used multiple times so let's compute it once
             const auto xsquare_negated = xsquared.negate();
 
+            /**
+             * One simultaneous inversion of the power vector replaces the full
+             * exponentiation that was previously paid for every index below
+             */
+            const auto y_inv_powers =
+                crypto_scalar_vector_t(std::vector<crypto_scalar_t>(y_powers.begin(), y_powers.begin() + MN)).invert();
+
+            const auto r1x = proof.r1 * x;
+
             for (size_t i = 0; i < MN; ++i)
             {
                 auto index = i;
 
-                auto g = proof.r1 * x * y.invert().pow(i);
+                auto g = r1x * y_inv_powers[i];
 
                 auto h = proof.s1 * x;
 
@@ -553,12 +809,24 @@ namespace Crypto::RangeProofs::BulletproofsPlus
                 points.append(Crypto::EIGHT * commitments[ii][j]);
             }
 
+            /**
+             * Both aggregates reuse vectors this proof already expanded: the
+             * inner product of all-ones with d is simply its sum, and the sum
+             * of y^1..y^MN reads straight out of the existing power vector
+             * instead of expanding the powers a second time
+             */
+            const auto d_sum = d.sum();
+
+            auto y_sum = Crypto::ZERO;
+
+            for (size_t i = 1; i <= MN; ++i)
+            {
+                y_sum += y_powers[i];
+            }
+
             H_scalar += weight
                         * ((proof.r1 * y * proof.s1)
-                           + (xsquared
-                              * (((ypow * z) * one_MN.inner_product(d))
-                                 + ((z.squared() - z)
-                                    * one_MN.inner_product(crypto_scalar_vector_t(y.pow_expand(MN, false, false)))))));
+                           + (xsquared * (((ypow * z) * d_sum) + ((z.squared() - z) * y_sum))));
 
             G_scalar += weight * proof.d1;
 
@@ -646,4 +914,54 @@ namespace Crypto::RangeProofs::BulletproofsPlus
             std::vector<std::vector<crypto_pedersen_commitment_t>>(1, commitments),
             N);
     }
+
+    /**
+     * The padding slots commit to a zero amount under the unit blinding factor
+     * so the padding commitment is a single compile-time-known constant
+     * @return
+     */
+    static const crypto_pedersen_commitment_t &padding_commitment()
+    {
+        static const auto commitment = Crypto::RingCT::generate_pedersen_commitment(Crypto::ONE, 0);
+
+        return commitment;
+    }
+
+    std::tuple<crypto_bulletproof_plus_t, std::vector<crypto_pedersen_commitment_t>> prove_padded(
+        const std::vector<uint64_t> &amounts,
+        const std::vector<crypto_blinding_factor_t> &blinding_factors,
+        size_t N,
+        size_t threads)
+    {
+        const auto real_outputs = amounts.size();
+
+        const auto padded_outputs = Crypto::pow2_round(real_outputs);
+
+        auto padded_amounts = amounts;
+
+        auto padded_blinding_factors = blinding_factors;
+
+        padded_amounts.resize(padded_outputs, 0);
+
+        padded_blinding_factors.resize(padded_outputs, Crypto::ONE);
+
+        auto [proof, commitments] = prove(padded_amounts, padded_blinding_factors, N, threads);
+
+        // only the real outputs' commitments travel; the padding is a known constant
+        commitments.resize(real_outputs);
+
+        return {proof, commitments};
+    }
+
+    bool verify_padded(
+        const crypto_bulletproof_plus_t &proof,
+        const std::vector<crypto_pedersen_commitment_t> &commitments,
+        size_t N)
+    {
+        auto padded_commitments = commitments;
+
+        padded_commitments.resize(Crypto::pow2_round(commitments.size()), padding_commitment());
+
+        return verify(proof, padded_commitments, N);
+    }
 } // namespace Crypto::RangeProofs::BulletproofsPlus
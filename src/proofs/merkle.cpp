@@ -24,7 +24,9 @@
 // STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <crypto_parallel.h>
 #include <proofs/merkle.h>
+#include <thread>
 
 static inline std::vector<crypto_hash_t> slice(const std::vector<crypto_hash_t> &values, size_t start, size_t count)
 {
@@ -43,12 +45,78 @@ static inline std::vector<crypto_hash_t> slice(const std::vector<crypto_hash_t>
 
 namespace Crypto::Merkle
 {
-    crypto_hash_t root_hash(const std::vector<crypto_hash_t> &hashes)
+    crypto_hash_t root_hash(const std::vector<crypto_hash_t> &hashes, size_t threads)
     {
         crypto_hash_t root_hash;
 
         const auto count = hashes.size();
 
+        if (threads == 0)
+        {
+            threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+
+        /**
+         * Large leaf sets reduce level by level across the worker pool; the
+         * reads of each level come from the previous level's buffer and the
+         * writes go to a separate one, so workers never race, and the
+         * resulting root is identical to the single-threaded reduction below
+         */
+        if (threads > 1 && count >= 4096)
+        {
+            auto cnt = count - 1;
+
+            for (size_t i = 1; i < 8 * sizeof(size_t); i <<= 1)
+            {
+                cnt |= cnt >> i;
+            }
+
+            cnt &= ~(cnt >> 1);
+
+            const auto rounds = (2 * cnt) - count;
+
+            std::vector<crypto_hash_t> current = slice(hashes, 0, cnt);
+
+            Crypto::Parallel::parallel_for(
+                0,
+                cnt - rounds,
+                [&](size_t k)
+                {
+                    static thread_local std::vector<crypto_hash_t> pair(2);
+
+                    pair[0] = hashes[rounds + (2 * k)];
+
+                    pair[1] = hashes[rounds + (2 * k) + 1];
+
+                    current[rounds + k] = crypto_hash_t::sha3(pair);
+                });
+
+            std::vector<crypto_hash_t> next(cnt / 2);
+
+            while (cnt > 2)
+            {
+                cnt >>= 1;
+
+                Crypto::Parallel::parallel_for(
+                    0,
+                    cnt,
+                    [&](size_t j)
+                    {
+                        static thread_local std::vector<crypto_hash_t> pair(2);
+
+                        pair[0] = current[2 * j];
+
+                        pair[1] = current[(2 * j) + 1];
+
+                        next[j] = crypto_hash_t::sha3(pair);
+                    });
+
+                std::swap(current, next);
+            }
+
+            return crypto_hash_t::sha3(current[0]);
+        }
+
         if (count == 0)
         {
             root_hash = crypto_hash_t();
@@ -74,11 +142,23 @@ namespace Crypto::Merkle
 
             const auto rounds = (2 * cnt) - count;
 
+            /**
+             * One flat scratch buffer holds the working level and a single
+             * reused pair buffer feeds the pair hash, so reducing the tree
+             * allocates exactly once regardless of depth; each level compacts
+             * in place over the front of the scratch
+             */
             std::vector<crypto_hash_t> temp_hashes = slice(hashes, 0, cnt);
 
+            std::vector<crypto_hash_t> pair(2);
+
             for (size_t i = rounds, j = rounds; j < cnt; i += 2, ++j)
             {
-                temp_hashes[j] = crypto_hash_t::sha3(slice(hashes, i, 2));
+                pair[0] = hashes[i];
+
+                pair[1] = hashes[i + 1];
+
+                temp_hashes[j] = crypto_hash_t::sha3(pair);
             }
 
             while (cnt > 2)
@@ -87,7 +167,11 @@ namespace Crypto::Merkle
 
                 for (size_t i = 0, j = 0; j < cnt; i += 2, ++j)
                 {
-                    temp_hashes[j] = crypto_hash_t::sha3(slice(temp_hashes, i, 2));
+                    pair[0] = temp_hashes[i];
+
+                    pair[1] = temp_hashes[i + 1];
+
+                    temp_hashes[j] = crypto_hash_t::sha3(pair);
                 }
             }
 
@@ -176,13 +260,23 @@ namespace Crypto::Merkle
 
         const auto rounds = (2 * cnt) - count;
 
+        /**
+         * As with root_hash the working level lives in one flat scratch buffer
+         * compacted in place and a single reused pair buffer feeds the hash
+         */
         std::vector<crypto_hash_t> temp_hashes;
 
         temp_hashes.resize(cnt - 1);
 
+        std::vector<crypto_hash_t> pair(2);
+
         for (size_t i = rounds, j = rounds - 1; j < cnt - 1; i += 2, ++j)
         {
-            temp_hashes[j] = crypto_hash_t::sha3(slice(hashes, i, 2));
+            pair[0] = hashes[i];
+
+            pair[1] = hashes[i + 1];
+
+            temp_hashes[j] = crypto_hash_t::sha3(pair);
         }
 
         while (depth > 0)
@@ -195,13 +289,78 @@ namespace Crypto::Merkle
 
             for (size_t i = 1, j = 0; j < cnt - 1; i += 2, ++j)
             {
-                temp_hashes[j] = crypto_hash_t::sha3(slice(temp_hashes, i, 2));
+                pair[0] = temp_hashes[i];
+
+                pair[1] = temp_hashes[i + 1];
+
+                temp_hashes[j] = crypto_hash_t::sha3(pair);
             }
         }
 
         return branches;
     }
 
+    std::vector<std::vector<crypto_hash_t>>
+        tree_branches(const std::vector<crypto_hash_t> &hashes, const std::vector<size_t> &leaf_indexes)
+    {
+        const auto count = hashes.size();
+
+        if (count < 2 || (count & (count - 1)) != 0)
+        {
+            throw std::runtime_error("multi-leaf branch extraction requires a power-of-two leaf count");
+        }
+
+        const auto depth = tree_depth(count);
+
+        /**
+         * The full set of tree levels is materialized in one traversal and
+         * every requested proof is then read out of the stored levels, turning
+         * n traversals into one when proofs for many leaves are needed
+         */
+        std::vector<std::vector<crypto_hash_t>> levels(depth + 1);
+
+        levels[0] = hashes;
+
+        std::vector<crypto_hash_t> pair(2);
+
+        for (size_t level = 0; level < depth; ++level)
+        {
+            levels[level + 1].resize(levels[level].size() / 2);
+
+            for (size_t i = 0; i < levels[level + 1].size(); ++i)
+            {
+                pair[0] = levels[level][2 * i];
+
+                pair[1] = levels[level][(2 * i) + 1];
+
+                levels[level + 1][i] = crypto_hash_t::sha3(pair);
+            }
+        }
+
+        std::vector<std::vector<crypto_hash_t>> results;
+
+        results.reserve(leaf_indexes.size());
+
+        for (const auto &leaf_index : leaf_indexes)
+        {
+            if (leaf_index >= count)
+            {
+                throw std::range_error("leaf index exceeds the leaf count");
+            }
+
+            std::vector<crypto_hash_t> branch(depth);
+
+            for (size_t level = 0; level < depth; ++level)
+            {
+                branch[depth - 1 - level] = levels[level][(leaf_index >> level) ^ 1];
+            }
+
+            results.push_back(branch);
+        }
+
+        return results;
+    }
+
     size_t tree_depth(size_t count)
     {
         size_t depth = 0;
@@ -219,3 +378,119 @@ namespace Crypto::Merkle
         return depth;
     }
 } // namespace Crypto::Merkle
+
+incremental_merkle_tree_t::incremental_merkle_tree_t(const std::vector<crypto_hash_t> &leaves)
+{
+    for (const auto &leaf : leaves)
+    {
+        append(leaf);
+    }
+}
+
+void incremental_merkle_tree_t::append(const crypto_hash_t &leaf)
+{
+    if (levels.empty())
+    {
+        levels.emplace_back();
+    }
+
+    levels[0].push_back(leaf);
+
+    /**
+     * Every time a level reaches an even count the append completed a new pair
+     * whereby exactly one parent node is produced and the process repeats one
+     * level up; an odd count means the new node is a dangling peak and the
+     * climb stops, which bounds each append at O(log n) hashes
+     */
+    for (size_t k = 0; levels[k].size() % 2 == 0; ++k)
+    {
+        if (k + 1 == levels.size())
+        {
+            levels.emplace_back();
+        }
+
+        const auto &children = levels[k];
+
+        levels[k + 1].push_back(combine(children[children.size() - 2], children.back()));
+    }
+}
+
+std::vector<crypto_hash_t> incremental_merkle_tree_t::branch() const
+{
+    const auto count = size();
+
+    if (count < 2 || (count & (count - 1)) != 0)
+    {
+        throw std::runtime_error("branch extraction requires a power-of-two leaf count");
+    }
+
+    const auto tree_depth = levels.size() - 1;
+
+    std::vector<crypto_hash_t> branches(tree_depth);
+
+    // the sibling of the leftmost node at each level proves the first leaf
+    for (size_t k = 0; k < tree_depth; ++k)
+    {
+        branches[tree_depth - 1 - k] = levels[k][1];
+    }
+
+    return branches;
+}
+
+size_t incremental_merkle_tree_t::depth() const
+{
+    return levels.empty() ? 0 : levels.size() - 1;
+}
+
+crypto_hash_t incremental_merkle_tree_t::root() const
+{
+    if (levels.empty() || levels[0].empty())
+    {
+        return {};
+    }
+
+    /**
+     * The unpaired (odd) node at each level is a peak; bagging them from the
+     * lowest level up yields the root without touching any completed subtree
+     */
+    bool have_root = false;
+
+    crypto_hash_t result;
+
+    for (const auto &level : levels)
+    {
+        if (level.size() % 2 == 0)
+        {
+            continue;
+        }
+
+        if (!have_root)
+        {
+            result = level.back();
+
+            have_root = true;
+        }
+        else
+        {
+            result = combine(level.back(), result);
+        }
+    }
+
+    return result;
+}
+
+size_t incremental_merkle_tree_t::size() const
+{
+    return levels.empty() ? 0 : levels[0].size();
+}
+
+crypto_hash_t incremental_merkle_tree_t::combine(const crypto_hash_t &left, const crypto_hash_t &right)
+{
+    std::vector<crypto_hash_t> buf(2);
+
+    buf[0] = left;
+
+    buf[1] = right;
+
+    return crypto_hash_t::sha3(buf);
+}
@@ -25,6 +25,7 @@
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <crypto_constants.h>
+#include <helpers/fixed_base_table_t.h>
 #include <helpers/scalar_transcript_t.h>
 #include <proofs/ringct.h>
 
@@ -74,8 +75,15 @@ namespace Crypto::RingCT
     {
         SCALAR_OR_THROW(blinding_factor);
 
-        // r = (amount * H) + (f * G)
-        return Crypto::INV_EIGHT * crypto_scalar_t(amount).dbl_mult(Crypto::H, blinding_factor, Crypto::G);
+        /**
+         * The commitment assembles in one interleaved pass over tables built
+         * for the pre-scaled bases (1/8)H and (1/8)G, so the cofactor-clearing
+         * INV_EIGHT multiply is folded into the precomputation and costs
+         * nothing per commitment; a uint64 amount touches at most sixteen
+         * windows of its table
+         */
+        // r = [(amount * H) + (f * G)] * (1/8)
+        return Crypto::H_inv8_table().dbl_mult(crypto_scalar_t(amount), Crypto::G_inv8_table(), blinding_factor);
     }
 
     std::tuple<std::vector<crypto_blinding_factor_t>, std::vector<crypto_pedersen_commitment_t>>
@@ -25,18 +25,39 @@
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <crypto_constants.h>
+#include <crypto_stats.h>
+#include <crypto_parallel.h>
 #include <helpers/dedupe_and_sort_keys.h>
 #include <helpers/scalar_transcript_t.h>
+#include <map>
 #include <signatures/ring_signature_borromean.h>
 
+/**
+ * Legacy rings overlap heavily during historical resync so the hash-to-point
+ * derivation of each ring member is shared across a whole verification batch;
+ * the comparator simply orders the keys by their byte representation
+ */
+typedef std::map<crypto_public_key_t, crypto_point_t, bool (*)(const crypto_public_key_t &, const crypto_public_key_t &)>
+    ring_member_point_cache_t;
+
+static bool ring_member_point_compare(const crypto_public_key_t &a, const crypto_public_key_t &b)
+{
+    return std::memcmp(a.data(), b.data(), a.size()) < 0;
+}
+
 namespace Crypto::RingSignature::Borromean
 {
-    bool check_ring_signature(
+    static bool check_ring_signature_cached(
         const crypto_hash_t &message_digest,
         const crypto_key_image_t &key_image,
         const std::vector<crypto_public_key_t> &public_keys,
-        const crypto_borromean_signature_t &borromean_signature)
+        const crypto_borromean_signature_t &borromean_signature,
+        const ring_member_point_cache_t *ring_member_points)
     {
+        CRYPTO_STATS_COUNT(ring_signature_checks)
+
+        CRYPTO_TIME_OPERATION("Borromean::check_ring_signature")
+
         // check to verify that there are no duplicate keys in the set
         {
             const auto keys = dedupe_and_sort_keys(public_keys);
@@ -68,7 +89,8 @@ namespace Crypto::RingSignature::Borromean
         for (size_t i = 0; i < ring_size; i++)
         {
             // HP = [Hp(P)] mod l
-            const auto HP = crypto_hash_t::sha3(public_keys[i]).point();
+            const auto HP = ring_member_points != nullptr ? ring_member_points->at(public_keys[i])
+                                                          : crypto_hash_t::sha3(public_keys[i]).point();
 
             // L = [(s[i].L * P) + (s[i].R * G)] mod l
             const auto L = signature[i].LR.L.dbl_mult(public_keys[i], signature[i].LR.R, Crypto::G);
@@ -93,6 +115,72 @@ namespace Crypto::RingSignature::Borromean
         return (challenge - sum).is_nonzero();
     }
 
+    bool check_ring_signature(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const std::vector<crypto_public_key_t> &public_keys,
+        const crypto_borromean_signature_t &borromean_signature)
+    {
+        return check_ring_signature_cached(message_digest, key_image, public_keys, borromean_signature, nullptr);
+    }
+
+    bool check_ring_signatures(
+        const std::vector<crypto_hash_t> &message_digests,
+        const std::vector<crypto_key_image_t> &key_images,
+        const std::vector<std::vector<crypto_public_key_t>> &public_keys,
+        const std::vector<crypto_borromean_signature_t> &signatures)
+    {
+        if (message_digests.size() != key_images.size() || message_digests.size() != public_keys.size()
+            || message_digests.size() != signatures.size())
+        {
+            return false;
+        }
+
+        /**
+         * The L and R points of each ring round feed the challenge transcript
+         * directly, so unlike equation-style schemes the per-round double
+         * scalar multiplications cannot be folded into one aggregate multiexp.
+         * What the batch does share is the hash-to-point derivation of every
+         * unique ring member -- derived once below -- after which the fully
+         * independent signatures are verified across the worker pool
+         */
+        ring_member_point_cache_t ring_member_points(ring_member_point_compare);
+
+        for (const auto &ring : public_keys)
+        {
+            for (const auto &public_key : ring)
+            {
+                if (ring_member_points.find(public_key) == ring_member_points.end())
+                {
+                    ring_member_points.emplace(public_key, crypto_hash_t::sha3(public_key).point());
+                }
+            }
+        }
+
+        std::vector<unsigned char> results(signatures.size(), 0);
+
+        Crypto::Parallel::parallel_for(
+            0,
+            signatures.size(),
+            [&](size_t i)
+            {
+                results[i] = check_ring_signature_cached(
+                                 message_digests[i], key_images[i], public_keys[i], signatures[i], &ring_member_points)
+                                 ? 1
+                                 : 0;
+            });
+
+        for (const auto &result : results)
+        {
+            if (result == 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     std::tuple<bool, crypto_borromean_signature_t> complete_ring_signature(
         const crypto_scalar_t &signing_scalar,
         size_t real_output_index,
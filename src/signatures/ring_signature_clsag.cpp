@@ -28,19 +28,157 @@
 // https://github.com/SarangNoether/skunkworks/tree/clsag
 
 #include <crypto_constants.h>
+#include <crypto_stats.h>
 #include <helpers/dedupe_and_sort_keys.h>
+#include <helpers/multiexp.h>
+#include <helpers/small_vector_t.h>
+#include <atomic>
+#include <helpers/wire_codec.h>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <helpers/scalar_transcript_t.h>
 #include <signatures/ring_signature_clsag.h>
 
+/**
+ * Rings overlap heavily between the signatures in a block so the hash-to-point
+ * derivation of each ring member is cached across an entire batch; the
+ * comparator simply orders the keys by their byte representation
+ */
+typedef std::map<crypto_public_key_t, crypto_point_t, bool (*)(const crypto_public_key_t &, const crypto_public_key_t &)>
+    ring_member_point_cache_t;
+
+static bool ring_member_point_compare(const crypto_public_key_t &a, const crypto_public_key_t &b)
+{
+    return std::memcmp(a.data(), b.data(), a.size()) < 0;
+}
+
+/**
+ * Returns the hash-to-point of the given ring member, deriving it exactly once
+ * per batch no matter how many rings the member appears in
+ * @param cache
+ * @param public_key
+ * @return
+ */
+static const crypto_point_t &
+    cached_ring_member_point(ring_member_point_cache_t &cache, const crypto_public_key_t &public_key)
+{
+    auto found = cache.find(public_key);
+
+    if (found == cache.end())
+    {
+        found = cache.emplace(public_key, crypto_hash_t::sha3(public_key).point()).first;
+    }
+
+    return found->second;
+}
+
 namespace Crypto::RingSignature::CLSAG
 {
-    bool check_ring_signature(
+    ring_context_t::ring_context_t(
+        std::vector<crypto_public_key_t> public_keys,
+        std::vector<crypto_pedersen_commitment_t> commitments):
+        ring_public_keys(std::move(public_keys)), ring_commitments(std::move(commitments))
+    {
+        // a ring with duplicate members (or no members) is never usable
+        const auto keys = dedupe_and_sort_keys(ring_public_keys);
+
+        is_valid = !ring_public_keys.empty() && keys.size() == ring_public_keys.size();
+
+        if (!is_valid)
+        {
+            return;
+        }
+
+        ring_member_points.reserve(ring_public_keys.size());
+
+        for (const auto &public_key : ring_public_keys)
+        {
+            ring_member_points.push_back(crypto_hash_t::sha3(public_key).point());
+        }
+
+        auto writer = Serialization::serializer_t();
+
+        writer.pod(ring_public_keys);
+
+        writer.pod(ring_commitments);
+
+        hash = crypto_hash_t::sha3(writer.data(), writer.size());
+    }
+
+    ring_context_t::ring_context_t(
+        const unsigned char *key_data,
+        size_t key_count,
+        const unsigned char *commitment_data,
+        size_t commitment_count)
+    {
+        // the keys load straight out of the mapped region, decompressing each exactly once
+        auto [keys_success, keys] = crypto_point_vector_t::load(key_data, key_count);
+
+        if (!keys_success)
+        {
+            is_valid = false;
+
+            return;
+        }
+
+        std::vector<crypto_pedersen_commitment_t> loaded_commitments;
+
+        if (commitment_data != nullptr && commitment_count != 0)
+        {
+            auto [commitments_success, loaded] = crypto_point_vector_t::load(commitment_data, commitment_count);
+
+            if (!commitments_success)
+            {
+                is_valid = false;
+
+                return;
+            }
+
+            loaded_commitments = std::move(loaded.container);
+        }
+
+        *this = ring_context_t(std::move(keys.container), std::move(loaded_commitments));
+    }
+
+    const std::vector<crypto_pedersen_commitment_t> &ring_context_t::commitments() const
+    {
+        return ring_commitments;
+    }
+
+    const std::vector<crypto_point_t> &ring_context_t::member_points() const
+    {
+        return ring_member_points;
+    }
+
+    const std::vector<crypto_public_key_t> &ring_context_t::public_keys() const
+    {
+        return ring_public_keys;
+    }
+
+    const crypto_hash_t &ring_context_t::ring_hash() const
+    {
+        return hash;
+    }
+
+    bool ring_context_t::valid() const
+    {
+        return is_valid;
+    }
+
+    static bool check_ring_signature_cached(
         const crypto_hash_t &message_digest,
         const crypto_key_image_t &key_image,
         const std::vector<crypto_public_key_t> &public_keys,
         const crypto_clsag_signature_t &signature,
-        const std::vector<crypto_pedersen_commitment_t> &commitments)
+        const std::vector<crypto_pedersen_commitment_t> &commitments,
+        ring_member_point_cache_t &ring_member_points)
     {
+        CRYPTO_STATS_COUNT(ring_signature_checks)
+
+        CRYPTO_TIME_OPERATION("CLSAG::check_ring_signature")
+
         const auto use_commitments =
             (signature.commitment_image.valid() && commitments.size() == public_keys.size()
              && signature.pseudo_commitment.valid());
@@ -69,8 +207,12 @@ namespace Crypto::RingSignature::CLSAG
 
         const auto &h0 = signature.challenge;
 
-        // the computational hash vector is only as big as our ring (not including the check hash)
-        std::vector<crypto_scalar_t> h(ring_size);
+        /**
+         * The computational hash vector is only as big as our ring (not
+         * including the check hash) and lives inline on the stack for
+         * production ring sizes
+         */
+        small_vector_t<crypto_scalar_t> h(ring_size);
 
         crypto_scalar_t mu_P, mu_C;
 
@@ -137,6 +279,19 @@ namespace Crypto::RingSignature::CLSAG
             transcript.update(signature.pseudo_commitment);
         }
 
+        /**
+         * The key image is a fixed base of every ring round's R computation so
+         * its precomputed multiples table is built exactly once per check
+         * instead of being rebuilt inside each generic double multiplication
+         */
+        ge_dsmp key_image_precomp;
+
+        {
+            const auto key_image_p3 = key_image.p3();
+
+            ge_dsm_precomp(key_image_precomp, &key_image_p3);
+        }
+
         for (size_t i = 0; i < ring_size; i++)
         {
             auto temp_h = h[i];
@@ -151,14 +306,10 @@ namespace Crypto::RingSignature::CLSAG
             // r = (temp_h * mu_P) mod l
             const auto r = temp_h * mu_P;
 
-            // L = [(r * P[idx]) + (s[idx] * G)] mod l
-            auto L = r.dbl_mult(public_keys[idx], signature.scalars[idx], Crypto::G);
-
             // HP = [Hp(P[idx])] mod l
-            const auto HP = crypto_hash_t::sha3(public_keys[idx]).point();
+            const auto &HP = cached_ring_member_point(ring_member_points, public_keys[idx]);
 
-            // R = [(s[idx] * HP) + (r * I)] mod l
-            auto R = signature.scalars[idx].dbl_mult(HP, r, key_image);
+            crypto_point_t L, R;
 
             if (use_commitments)
             {
@@ -175,11 +326,43 @@ namespace Crypto::RingSignature::CLSAG
                 // C = (C[idx] - PS) mod l
                 const auto C = Crypto::EIGHT * (commitments[idx] - signature.pseudo_commitment);
 
-                // L += [r2 * (C[idx] - PS)] mod l
-                L += (r2 * C);
+                // L = [(r * P[idx]) + (s[idx] * G) + (r2 * (C[idx] - PS))] mod l
+                const crypto_scalar_t L_scalars[3] = {r, signature.scalars[idx], r2};
+
+                const crypto_point_t L_points[3] = {public_keys[idx], Crypto::G, C};
+
+                L = Crypto::multi_mult(L_scalars, L_points, 3);
+
+                // R = [(s[idx] * HP) + (r * I) + (r2 * D)] mod l
+                const crypto_scalar_t R_scalars[3] = {signature.scalars[idx], r, r2};
+
+                const crypto_point_t R_points[3] = {HP, key_image, signature.commitment_image};
+
+                R = Crypto::multi_mult(R_scalars, R_points, 3);
+            }
+            else
+            {
+                // L = [(r * P[idx]) + (s[idx] * G)] mod l
+                L = r.dbl_mult(public_keys[idx], signature.scalars[idx], Crypto::G);
+
+                // R = [(s[idx] * HP) + (r * I)] mod l against the cached key image table
+                ge_p1p1 r_p1p1;
+
+                auto hp_p3 = HP.p3();
+
+                ge_double_scalarmult_negate_vartime(
+                    &r_p1p1, signature.scalars[idx].data(), &hp_p3, r.data(), key_image_precomp);
+
+                ge_p3 r_p3;
+
+                ge_p1p1_to_p3(&r_p3, &r_p1p1);
 
-                // R += (r2 * D) mod l
-                R += (r2 * signature.commitment_image);
+                R = crypto_point_t(r_p3);
+
+                if (R == Crypto::ZP)
+                {
+                    R = Crypto::Z;
+                }
             }
 
             auto sub_transcript = transcript;
@@ -200,6 +383,272 @@ namespace Crypto::RingSignature::CLSAG
         return h[0] == h0;
     }
 
+    bool check_ring_signature(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const std::vector<crypto_public_key_t> &public_keys,
+        const crypto_clsag_signature_t &signature,
+        const std::vector<crypto_pedersen_commitment_t> &commitments)
+    {
+        ring_member_point_cache_t ring_member_points(ring_member_point_compare);
+
+        return check_ring_signature_cached(
+            message_digest, key_image, public_keys, signature, commitments, ring_member_points);
+    }
+
+    bool check_ring_signature(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const ring_context_t &ring,
+        const crypto_clsag_signature_t &signature)
+    {
+        if (!ring.valid())
+        {
+            return false;
+        }
+
+        /**
+         * Seeding the round cache from the context costs a handful of map inserts
+         * of already-derived points instead of a hash-to-point per ring member
+         */
+        ring_member_point_cache_t ring_member_points(ring_member_point_compare);
+
+        for (size_t i = 0; i < ring.public_keys().size(); ++i)
+        {
+            ring_member_points.emplace(ring.public_keys()[i], ring.member_points()[i]);
+        }
+
+        return check_ring_signature_cached(
+            message_digest, key_image, ring.public_keys(), signature, ring.commitments(), ring_member_points);
+    }
+
+    std::future<bool> check_ring_signature_async(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const std::vector<crypto_public_key_t> &public_keys,
+        const crypto_clsag_signature_t &signature,
+        const std::vector<crypto_pedersen_commitment_t> &commitments)
+    {
+        return Crypto::Parallel::async(
+            [message_digest, key_image, public_keys, signature, commitments]()
+            { return check_ring_signature(message_digest, key_image, public_keys, signature, commitments); });
+    }
+
+    /**
+     * The shared per-ring LRU cache: contexts are keyed by their aggregate
+     * ring hash with the most recently used ring at the front of the order
+     * list; everything is guarded by one mutex as lookups are trivially cheap
+     * next to the per-ring work the cache saves
+     */
+    static std::mutex ring_cache_mutex;
+
+    static size_t ring_cache_capacity = 1024;
+
+    static std::list<crypto_hash_t> ring_cache_order;
+
+    typedef std::map<
+        crypto_hash_t,
+        std::pair<std::shared_ptr<const ring_context_t>, std::list<crypto_hash_t>::iterator>,
+        bool (*)(const crypto_hash_t &, const crypto_hash_t &)>
+        ring_cache_t;
+
+    static bool ring_cache_compare(const crypto_hash_t &a, const crypto_hash_t &b)
+    {
+        return std::memcmp(a.data(), b.data(), a.size()) < 0;
+    }
+
+    static ring_cache_t ring_cache(ring_cache_compare);
+
+    bool check_ring_signature_with_cache(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const std::vector<crypto_public_key_t> &public_keys,
+        const crypto_clsag_signature_t &signature,
+        const std::vector<crypto_pedersen_commitment_t> &commitments)
+    {
+        if (ring_cache_capacity == 0)
+        {
+            return check_ring_signature(message_digest, key_image, public_keys, signature, commitments);
+        }
+
+        // the cache key covers the full member set (keys and commitments)
+        crypto_hash_t ring_hash;
+
+        {
+            auto writer = Serialization::serializer_t();
+
+            writer.pod(public_keys);
+
+            writer.pod(commitments);
+
+            ring_hash = crypto_hash_t::sha3(writer.data(), writer.size());
+        }
+
+        std::shared_ptr<const ring_context_t> context;
+
+        {
+            std::scoped_lock lock(ring_cache_mutex);
+
+            auto found = ring_cache.find(ring_hash);
+
+            if (found != ring_cache.end())
+            {
+                // refresh the entry's position in the recency order
+                ring_cache_order.erase(found->second.second);
+
+                ring_cache_order.push_front(ring_hash);
+
+                found->second.second = ring_cache_order.begin();
+
+                context = found->second.first;
+            }
+        }
+
+        if (!context)
+        {
+            context = std::make_shared<const ring_context_t>(public_keys, commitments);
+
+            std::scoped_lock lock(ring_cache_mutex);
+
+            ring_cache_order.push_front(ring_hash);
+
+            const auto [entry, inserted] =
+                ring_cache.emplace(ring_hash, std::make_pair(context, ring_cache_order.begin()));
+
+            // another thread may have populated the ring while we built it
+            if (!inserted)
+            {
+                ring_cache_order.pop_front();
+
+                context = entry->second.first;
+            }
+
+            while (ring_cache.size() > ring_cache_capacity)
+            {
+                ring_cache.erase(ring_cache_order.back());
+
+                ring_cache_order.pop_back();
+            }
+        }
+
+        return check_ring_signature(message_digest, key_image, *context, signature);
+    }
+
+    void set_ring_cache_capacity(size_t rings)
+    {
+        std::scoped_lock lock(ring_cache_mutex);
+
+        ring_cache_capacity = rings;
+
+        while (ring_cache.size() > ring_cache_capacity)
+        {
+            ring_cache.erase(ring_cache_order.back());
+
+            ring_cache_order.pop_back();
+        }
+    }
+
+    bool check_ring_signatures(
+        const std::vector<crypto_hash_t> &message_digests,
+        const std::vector<crypto_key_image_t> &key_images,
+        const std::vector<std::vector<crypto_public_key_t>> &public_keys,
+        const std::vector<crypto_clsag_signature_t> &signatures,
+        const std::vector<std::vector<crypto_pedersen_commitment_t>> &commitments)
+    {
+        if (message_digests.size() != key_images.size() || message_digests.size() != public_keys.size()
+            || message_digests.size() != signatures.size())
+        {
+            return false;
+        }
+
+        if (!commitments.empty() && commitments.size() != signatures.size())
+        {
+            return false;
+        }
+
+        /**
+         * The hash-to-point of every ring member is shared across the entire batch
+         * so that overlapping rings only ever pay for the derivation once
+         */
+        ring_member_point_cache_t ring_member_points(ring_member_point_compare);
+
+        static const std::vector<crypto_pedersen_commitment_t> no_commitments;
+
+        for (size_t i = 0; i < signatures.size(); ++i)
+        {
+            const auto &signature_commitments = commitments.empty() ? no_commitments : commitments[i];
+
+            if (!check_ring_signature_cached(
+                    message_digests[i],
+                    key_images[i],
+                    public_keys[i],
+                    signatures[i],
+                    signature_commitments,
+                    ring_member_points))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    prepared_signature_t::prepared_signature_t(
+        crypto_clsag_signature_t signature,
+        size_t real_output_index,
+        std::vector<crypto_scalar_t> h,
+        const crypto_scalar_t &mu_P):
+        signature(std::move(signature)), real_output_index(real_output_index), h(std::move(h)), mu_P(mu_P)
+    {
+    }
+
+    void prepared_signature_t::from_bytes(const unsigned char *data, size_t length)
+    {
+        auto cursor = data;
+
+        const auto end = data + length;
+
+        const auto signature_length = WireCodec::read_varint(cursor, end);
+
+        if (size_t(end - cursor) < signature_length)
+        {
+            throw std::invalid_argument("Could not deserialize prepared_signature_t");
+        }
+
+        signature.from_bytes(cursor, signature_length);
+
+        cursor += signature_length;
+
+        real_output_index = size_t(WireCodec::read_varint(cursor, end));
+
+        h = WireCodec::read_pod_vector<crypto_scalar_t>(cursor, end);
+
+        mu_P = WireCodec::read_pod<crypto_scalar_t>(cursor, end);
+    }
+
+    std::vector<uint8_t> prepared_signature_t::to_bytes() const
+    {
+        const auto signature_bytes = signature.to_bytes();
+
+        std::vector<uint8_t> result;
+
+        result.reserve(
+            WireCodec::varint_size(signature_bytes.size()) + signature_bytes.size()
+            + WireCodec::varint_size(real_output_index) + WireCodec::varint_size(h.size()) + (h.size() * 32) + 32);
+
+        WireCodec::write_varint(result, signature_bytes.size());
+
+        result.insert(result.end(), signature_bytes.begin(), signature_bytes.end());
+
+        WireCodec::write_varint(result, real_output_index);
+
+        WireCodec::write_pod_vector(result, h);
+
+        WireCodec::write_pod(result, mu_P);
+
+        return result;
+    }
+
     std::tuple<bool, crypto_clsag_signature_t> complete_ring_signature(
         const crypto_scalar_t &signing_scalar,
         size_t real_output_index,
@@ -245,6 +694,64 @@ namespace Crypto::RingSignature::CLSAG
                 finalized_signature, signature.challenge, signature.commitment_image, signature.pseudo_commitment)};
     }
 
+    std::tuple<bool, crypto_clsag_signature_t>
+        complete_ring_signature(const crypto_scalar_t &signing_scalar, const prepared_signature_t &prepared)
+    {
+        return complete_ring_signature(
+            signing_scalar, prepared.real_output_index, prepared.signature, prepared.h, prepared.mu_P);
+    }
+
+    std::tuple<bool, std::vector<crypto_clsag_signature_t>>
+        generate_ring_signatures(const std::vector<signing_job_t> &jobs)
+    {
+        std::vector<crypto_clsag_signature_t> results(jobs.size());
+
+        std::atomic<bool> failed {false};
+
+        /**
+         * The jobs are fully independent so they stream across the pool; with
+         * many in flight per worker the transcript hashing of one input
+         * overlaps the mask generation and scalar multiplication of others
+         */
+        Crypto::Parallel::parallel_for(
+            0,
+            jobs.size(),
+            [&](size_t i)
+            {
+                if (failed)
+                {
+                    return;
+                }
+
+                const auto &job = jobs[i];
+
+                const auto [success, signature] = generate_ring_signature(
+                    job.message_digest,
+                    job.secret_ephemeral,
+                    job.public_keys,
+                    job.input_blinding_factor,
+                    job.public_commitments,
+                    job.pseudo_blinding_factor,
+                    job.pseudo_commitment);
+
+                if (!success)
+                {
+                    failed = true;
+
+                    return;
+                }
+
+                results[i] = signature;
+            });
+
+        if (failed)
+        {
+            return {false, {}};
+        }
+
+        return {true, results};
+    }
+
     std::tuple<bool, crypto_clsag_signature_t> generate_ring_signature(
         const crypto_hash_t &message_digest,
         const crypto_scalar_t &secret_ephemeral,
@@ -345,15 +852,17 @@ namespace Crypto::RingSignature::CLSAG
         return complete_ring_signature(secret_ephemeral, real_output_index, signature, h, mu_P);
     }
 
-    std::tuple<bool, crypto_clsag_signature_t, std::vector<crypto_scalar_t>, crypto_scalar_t> prepare_ring_signature(
-        const crypto_hash_t &message_digest,
-        const crypto_key_image_t &key_image,
-        const std::vector<crypto_public_key_t> &public_keys,
-        size_t real_output_index,
-        const crypto_blinding_factor_t &input_blinding_factor,
-        const std::vector<crypto_pedersen_commitment_t> &public_commitments,
-        const crypto_blinding_factor_t &pseudo_blinding_factor,
-        const crypto_pedersen_commitment_t &pseudo_commitment)
+    static std::tuple<bool, crypto_clsag_signature_t, std::vector<crypto_scalar_t>, crypto_scalar_t>
+        prepare_ring_signature_internal(
+            const crypto_hash_t &message_digest,
+            const crypto_key_image_t &key_image,
+            const std::vector<crypto_public_key_t> &public_keys,
+            size_t real_output_index,
+            const crypto_blinding_factor_t &input_blinding_factor,
+            const std::vector<crypto_pedersen_commitment_t> &public_commitments,
+            const crypto_blinding_factor_t &pseudo_blinding_factor,
+            const crypto_pedersen_commitment_t &pseudo_commitment,
+            const std::vector<crypto_point_t> *ring_member_points)
     {
         // check to verify that there are no duplicate keys in the set
         {
@@ -510,7 +1019,8 @@ namespace Crypto::RingSignature::CLSAG
             const auto L = alpha_scalar * G;
 
             // HP = [Hp(P)] mod l
-            const auto HP = crypto_hash_t::sha3(public_keys[real_output_index]).point();
+            const auto HP = ring_member_points != nullptr ? (*ring_member_points)[real_output_index]
+                                                          : crypto_hash_t::sha3(public_keys[real_output_index]).point();
 
             // R = (alpha * HP) mod l
             const auto R = alpha_scalar * HP;
@@ -539,14 +1049,11 @@ namespace Crypto::RingSignature::CLSAG
                 // r = (h[idx] * mu_P) mod l
                 const auto r = h[idx] * mu_P;
 
-                // L = [(r * P) + (s[idx] * G)] mod l
-                auto L = r.dbl_mult(public_keys[idx], signature[idx], Crypto::G);
-
                 // HP = [Hp(P)] mod l
-                const auto HP = crypto_hash_t::sha3(public_keys[idx]).point();
+                const auto HP = ring_member_points != nullptr ? (*ring_member_points)[idx]
+                                                              : crypto_hash_t::sha3(public_keys[idx]).point();
 
-                // R = [(s[idx] * HP) + (r * I)] mod l
-                auto R = signature[idx].dbl_mult(HP, r, key_image);
+                crypto_point_t L, R;
 
                 if (use_commitments)
                 {
@@ -563,11 +1070,27 @@ namespace Crypto::RingSignature::CLSAG
                     // C = (C[idx] - PS) mod l
                     const auto C = Crypto::EIGHT * (public_commitments[idx] - pseudo_commitment);
 
-                    // L += (r2 * C[idx]) mod l
-                    L += (r2 * C);
+                    // L = [(r * P) + (s[idx] * G) + (r2 * C[idx])] mod l
+                    const crypto_scalar_t L_scalars[3] = {r, signature[idx], r2};
+
+                    const crypto_point_t L_points[3] = {public_keys[idx], Crypto::G, C};
+
+                    L = Crypto::multi_mult(L_scalars, L_points, 3);
+
+                    // R = [(s[idx] * HP) + (r * I) + (r2 * D)] mod l
+                    const crypto_scalar_t R_scalars[3] = {signature[idx], r, r2};
+
+                    const crypto_point_t R_points[3] = {HP, key_image, commitment_image};
+
+                    R = Crypto::multi_mult(R_scalars, R_points, 3);
+                }
+                else
+                {
+                    // L = [(r * P) + (s[idx] * G)] mod l
+                    L = r.dbl_mult(public_keys[idx], signature[idx], Crypto::G);
 
-                    // R += (r2 * D) mod l
-                    R += (r2 * commitment_image);
+                    // R = [(s[idx] * HP) + (r * I)] mod l
+                    R = signature[idx].dbl_mult(HP, r, key_image);
                 }
 
                 auto sub_transcript = transcript;
@@ -601,4 +1124,80 @@ namespace Crypto::RingSignature::CLSAG
 
         return {true, crypto_clsag_signature_t(signature, h[0], commitment_image, pseudo_commitment), h, mu_P};
     }
+
+    std::tuple<bool, crypto_clsag_signature_t, std::vector<crypto_scalar_t>, crypto_scalar_t> prepare_ring_signature(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const std::vector<crypto_public_key_t> &public_keys,
+        size_t real_output_index,
+        const crypto_blinding_factor_t &input_blinding_factor,
+        const std::vector<crypto_pedersen_commitment_t> &public_commitments,
+        const crypto_blinding_factor_t &pseudo_blinding_factor,
+        const crypto_pedersen_commitment_t &pseudo_commitment)
+    {
+        return prepare_ring_signature_internal(
+            message_digest,
+            key_image,
+            public_keys,
+            real_output_index,
+            input_blinding_factor,
+            public_commitments,
+            pseudo_blinding_factor,
+            pseudo_commitment,
+            nullptr);
+    }
+
+    std::tuple<bool, crypto_clsag_signature_t, std::vector<crypto_scalar_t>, crypto_scalar_t> prepare_ring_signature(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const ring_context_t &ring,
+        size_t real_output_index,
+        const crypto_blinding_factor_t &input_blinding_factor,
+        const crypto_blinding_factor_t &pseudo_blinding_factor,
+        const crypto_pedersen_commitment_t &pseudo_commitment)
+    {
+        if (!ring.valid())
+        {
+            return {false, {}, {}, {}};
+        }
+
+        return prepare_ring_signature_internal(
+            message_digest,
+            key_image,
+            ring.public_keys(),
+            real_output_index,
+            input_blinding_factor,
+            ring.commitments(),
+            pseudo_blinding_factor,
+            pseudo_commitment,
+            &ring.member_points());
+    }
+
+    std::tuple<bool, prepared_signature_t> prepare_signature(
+        const crypto_hash_t &message_digest,
+        const crypto_key_image_t &key_image,
+        const std::vector<crypto_public_key_t> &public_keys,
+        size_t real_output_index,
+        const crypto_blinding_factor_t &input_blinding_factor,
+        const std::vector<crypto_pedersen_commitment_t> &public_commitments,
+        const crypto_blinding_factor_t &pseudo_blinding_factor,
+        const crypto_pedersen_commitment_t &pseudo_commitment)
+    {
+        auto [success, signature, h, mu_P] = prepare_ring_signature(
+            message_digest,
+            key_image,
+            public_keys,
+            real_output_index,
+            input_blinding_factor,
+            public_commitments,
+            pseudo_blinding_factor,
+            pseudo_commitment);
+
+        if (!success)
+        {
+            return {false, {}};
+        }
+
+        return {true, prepared_signature_t(std::move(signature), real_output_index, std::move(h), mu_P)};
+    }
 } // namespace Crypto::RingSignature::CLSAG
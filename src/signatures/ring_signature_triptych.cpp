@@ -28,13 +28,44 @@
 // https://github.com/SarangNoether/skunkworks/tree/triptych
 
 #include <crypto_constants.h>
+#include <crypto_stats.h>
 #include <helpers/dedupe_and_sort_keys.h>
 #include <helpers/gray_code_generator_t.h>
 #include <helpers/scalar_transcript_t.h>
+#include <mutex>
 #include <signatures/ring_signature_triptych.h>
 
 typedef std::vector<std::vector<crypto_scalar_t>> triptych_crypto_scalar_vector_t;
 
+static std::mutex triptych_tensor_mutex;
+
+/**
+ * The commitment tensor points depend only on their (i,j) position (the domain
+ * point is fixed) so they are derived once and cached for every subsequent
+ * signature rather than being re-hashed per verification
+ * @param i
+ * @param j
+ * @return
+ */
+static crypto_point_t cached_commitment_tensor_point(size_t i, size_t j)
+{
+    std::scoped_lock lock(triptych_tensor_mutex);
+
+    static std::vector<std::vector<crypto_point_t>> cache;
+
+    if (i >= cache.size())
+    {
+        cache.resize(i + 1);
+    }
+
+    while (cache[i].size() <= j)
+    {
+        cache[i].push_back(Crypto::commitment_tensor_point(TRIPTYCH_DOMAIN_1, i, cache[i].size()));
+    }
+
+    return cache[i][j];
+}
+
 static inline crypto_point_t commitment_tensor(const triptych_crypto_scalar_vector_t &v, const crypto_scalar_t &r)
 {
     auto C = Crypto::Z;
@@ -43,7 +74,7 @@ static inline crypto_point_t commitment_tensor(const triptych_crypto_scalar_vect
     {
         for (size_t j = 0; j < v[i].size(); ++j)
         {
-            C += v[i][j] * Crypto::commitment_tensor_point(TRIPTYCH_DOMAIN_1, i, j);
+            C += v[i][j] * cached_commitment_tensor_point(i, j);
         }
     }
 
@@ -52,6 +83,51 @@ static inline crypto_point_t commitment_tensor(const triptych_crypto_scalar_vect
     return C;
 }
 
+/**
+ * The prover's matrix scratch for one (ring size, tree depth) configuration;
+ * burst signing reuses the same workspace (and therefore the same allocated
+ * capacity) across every signature on the thread, while the commitment tensor
+ * points it multiplies against are cached library-wide
+ */
+struct triptych_prover_workspace_t
+{
+    triptych_crypto_scalar_vector_t a, sigma, a_sigma, a_sq, p;
+
+    std::vector<int> decomp_k;
+
+    /**
+     * Resets the workspace to the given dimensions retaining capacity
+     * @param m
+     * @param n
+     * @param N
+     */
+    void reset(size_t m, size_t n, size_t N)
+    {
+        resize_matrix(a, m, n);
+
+        resize_matrix(sigma, m, n);
+
+        resize_matrix(a_sigma, m, n);
+
+        resize_matrix(a_sq, m, n);
+
+        resize_matrix(p, N, 0);
+
+        decomp_k.assign(m, 0);
+    }
+
+  private:
+    static void resize_matrix(triptych_crypto_scalar_vector_t &matrix, size_t d1, size_t d2)
+    {
+        matrix.resize(d1);
+
+        for (auto &row : matrix)
+        {
+            row.assign(d2, Crypto::ZERO);
+        }
+    }
+};
+
 static inline triptych_crypto_scalar_vector_t init_triptych_scalar_vector(
     size_t d1,
     size_t d2,
@@ -84,6 +160,10 @@ namespace Crypto::RingSignature::Triptych
         const crypto_triptych_signature_t &signature,
         const std::vector<crypto_pedersen_commitment_t> &commitments)
     {
+        CRYPTO_STATS_COUNT(ring_signature_checks)
+
+        CRYPTO_TIME_OPERATION("Triptych::check_ring_signature")
+
         const size_t n = 2;
 
         // check to verify that there are no duplicate keys in the set
@@ -213,9 +293,9 @@ namespace Crypto::RingSignature::Triptych
 
         gray_code_generator_t gray_codes(n, m);
 
-        for (size_t k = 0; k < gray_codes.size(); ++k)
+        for (size_t k = 0; k < gray_codes.size(); ++k, gray_codes.advance())
         {
-            const auto &gray_update = gray_codes[k];
+            const auto &gray_update = gray_codes.current();
 
             if (k > 0)
             {
@@ -240,7 +320,269 @@ namespace Crypto::RingSignature::Triptych
 
         RY -= signature.z * key_image;
 
-        return RX.empty() && RY.empty();
+        return RX.is_identity() && RY.is_identity();
+    }
+
+    bool check_ring_signatures(
+        const std::vector<crypto_hash_t> &message_digests,
+        const std::vector<crypto_key_image_t> &key_images,
+        const std::vector<std::vector<crypto_public_key_t>> &public_keys,
+        const std::vector<crypto_triptych_signature_t> &signatures,
+        const std::vector<std::vector<crypto_pedersen_commitment_t>> &commitments)
+    {
+        const size_t n = 2;
+
+        if (message_digests.size() != key_images.size() || message_digests.size() != public_keys.size()
+            || message_digests.size() != signatures.size() || message_digests.size() != commitments.size())
+        {
+            return false;
+        }
+
+        // an empty batch is vacuously valid, matching the rest of the batch APIs
+        if (signatures.empty())
+        {
+            return true;
+        }
+
+        size_t max_m = 0;
+
+        /**
+         * Every point equation of every signature in the batch is folded into a
+         * single random-linear-combination weighted multiexp; the commitment
+         * tensor points are shared across the whole batch via per-position
+         * scalar accumulators so each tensor point appears exactly once
+         */
+        crypto_scalar_vector_t scalars;
+
+        crypto_point_vector_t points;
+
+        std::vector<std::vector<crypto_scalar_t>> tensor_scalars;
+
+        auto G_scalar = Crypto::ZERO, H_scalar = Crypto::ZERO, U_scalar = Crypto::ZERO;
+
+        for (size_t sig = 0; sig < signatures.size(); ++sig)
+        {
+            const auto &signature = signatures[sig];
+
+            const auto &ring = public_keys[sig];
+
+            const auto &ring_commitments = commitments[sig];
+
+            // check to verify that there are no duplicate keys in the set
+            {
+                const auto keys = dedupe_and_sort_keys(ring);
+
+                if (keys.size() != ring.size())
+                {
+                    return false;
+                }
+            }
+
+            // checks to verify that it is a proper power of two
+            const auto [m_found, m] = Crypto::calculate_base2_exponent(ring.size());
+
+            if (!m_found || m < 2)
+            {
+                return false;
+            }
+
+            if (ring.size() != ring_commitments.size())
+            {
+                return false;
+            }
+
+            if (!key_images[sig].check_subgroup())
+            {
+                return false;
+            }
+
+            if (!signature.check_construction(m, n))
+            {
+                return false;
+            }
+
+            if (m > max_m)
+            {
+                max_m = m;
+
+                tensor_scalars.resize(max_m, std::vector<crypto_scalar_t>(n, Crypto::ZERO));
+            }
+
+            auto tr = scalar_transcript_t(TRIPTYCH_DOMAIN_0, message_digests[sig]);
+
+            tr.update(ring);
+
+            tr.update(ring_commitments);
+
+            tr.update(signature.pseudo_commitment);
+
+            tr.update(key_images[sig]);
+
+            tr.update(signature.commitment_image);
+
+            tr.update(signature.A);
+
+            tr.update(signature.B);
+
+            tr.update(signature.C);
+
+            tr.update(signature.D);
+
+            const auto mu = tr.challenge();
+
+            if (!mu.valid())
+            {
+                return false;
+            }
+
+            tr.update(signature.X);
+
+            tr.update(signature.Y);
+
+            const auto x = tr.challenge();
+
+            if (!x.valid())
+            {
+                return false;
+            }
+
+            auto f = init_triptych_scalar_vector(m, n);
+
+            for (size_t j = 0; j < m; ++j)
+            {
+                f[j][0] = x;
+
+                for (size_t i = 1; i < n; ++i)
+                {
+                    f[j][i] = signature.f[j][i - 1];
+
+                    f[j][0] -= f[j][i];
+                }
+            }
+
+            // each equation carries its own weight so that none can cancel another
+            const auto wAB = crypto_scalar_t::random(), wCD = crypto_scalar_t::random(),
+                       wX = crypto_scalar_t::random(), wY = crypto_scalar_t::random();
+
+            // A/B check: tensor(f, zA) - (x * B) - A = 0
+            for (size_t j = 0; j < m; ++j)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    tensor_scalars[j][i] += wAB * f[j][i];
+                }
+            }
+
+            H_scalar += wAB * signature.zA;
+
+            scalars.append((wAB * x).negate());
+
+            points.append(signature.B);
+
+            scalars.append(wAB.negate());
+
+            points.append(signature.A);
+
+            // C/D check: tensor(f * (x - f), zC) - (x * C) - D = 0
+            for (size_t j = 0; j < m; ++j)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    tensor_scalars[j][i] += wCD * (f[j][i] * (x - f[j][i]));
+                }
+            }
+
+            H_scalar += wCD * signature.zC;
+
+            scalars.append((wCD * x).negate());
+
+            points.append(signature.C);
+
+            scalars.append(wCD.negate());
+
+            points.append(signature.D);
+
+            // RX/RY checks folded with per-ring-member coefficients
+            auto t = Crypto::ONE;
+
+            for (size_t j = 0; j < m; ++j)
+            {
+                t *= f[j][0];
+            }
+
+            auto t_sum = Crypto::ZERO;
+
+            gray_code_generator_t gray_codes(n, m);
+
+            for (size_t k = 0; k < gray_codes.size(); ++k, gray_codes.advance())
+            {
+                const auto &gray_update = gray_codes.current();
+
+                if (k > 0)
+                {
+                    t *= f[gray_update[0]][gray_update[1]].invert() * f[gray_update[0]][gray_update[2]];
+                }
+
+                t_sum += t;
+
+                scalars.append(wX * t);
+
+                points.append(ring[k]);
+
+                scalars.append(wX * t * mu);
+
+                points.append((ring_commitments[k] - signature.pseudo_commitment).mul8());
+            }
+
+            for (size_t j = 0; j < m; ++j)
+            {
+                const auto xpow = x.pow(j);
+
+                scalars.append((wX * xpow).negate());
+
+                points.append(signature.X[j]);
+
+                scalars.append((wY * xpow).negate());
+
+                points.append(signature.Y[j]);
+            }
+
+            G_scalar -= wX * signature.z;
+
+            U_scalar += wY * t_sum;
+
+            scalars.append(wY * mu * t_sum);
+
+            points.append(signature.commitment_image);
+
+            scalars.append((wY * signature.z).negate());
+
+            points.append(key_images[sig]);
+        }
+
+        scalars.append(G_scalar);
+
+        points.append(Crypto::G);
+
+        scalars.append(H_scalar);
+
+        points.append(Crypto::H);
+
+        scalars.append(U_scalar);
+
+        points.append(Crypto::U);
+
+        for (size_t j = 0; j < max_m; ++j)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                scalars.append(tensor_scalars[j][i]);
+
+                points.append(cached_commitment_tensor_point(j, i));
+            }
+        }
+
+        return scalars.inner_product(points).is_identity();
     }
 
     std::tuple<bool, crypto_triptych_signature_t> complete_ring_signature(
@@ -435,7 +777,16 @@ namespace Crypto::RingSignature::Triptych
             goto try_again;
         }
 
-        auto a = init_triptych_scalar_vector(m, n, true);
+        static thread_local triptych_prover_workspace_t workspace;
+
+        workspace.reset(m, n, N);
+
+        auto &a = workspace.a;
+
+        for (auto &row : a)
+        {
+            row = crypto_scalar_t::random(n);
+        }
 
         for (size_t j = 0; j < m; ++j)
         {
@@ -453,7 +804,7 @@ namespace Crypto::RingSignature::Triptych
 
         const auto decomp_l = gray.v_value();
 
-        auto sigma = init_triptych_scalar_vector(m, n);
+        auto &sigma = workspace.sigma;
 
         for (size_t j = 0; j < m; ++j)
         {
@@ -465,7 +816,7 @@ namespace Crypto::RingSignature::Triptych
 
         const auto B = commitment_tensor(sigma, rB);
 
-        auto a_sigma = init_triptych_scalar_vector(m, n);
+        auto &a_sigma = workspace.a_sigma;
 
         for (size_t j = 0; j < m; ++j)
         {
@@ -477,7 +828,7 @@ namespace Crypto::RingSignature::Triptych
 
         const auto C = commitment_tensor(a_sigma, rC);
 
-        auto a_sq = init_triptych_scalar_vector(m, n);
+        auto &a_sq = workspace.a_sq;
 
         for (size_t j = 0; j < m; ++j)
         {
@@ -489,15 +840,15 @@ namespace Crypto::RingSignature::Triptych
 
         const auto D = commitment_tensor(a_sq, rD);
 
-        auto p = init_triptych_scalar_vector(N, 0);
+        auto &p = workspace.p;
 
-        auto decomp_k = std::vector<int>(m, 0);
+        auto &decomp_k = workspace.decomp_k;
 
         gray_code_generator_t gray_codes(n, m);
 
-        for (size_t k = 0; k < gray_codes.size(); ++k)
+        for (size_t k = 0; k < gray_codes.size(); ++k, gray_codes.advance())
         {
-            const auto &gray_update = gray_codes[k];
+            const auto &gray_update = gray_codes.current();
 
             decomp_k[gray_update[0]] = gray_update[2];
 
@@ -24,7 +24,9 @@
 // STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <atomic>
 #include <crypto_constants.h>
+#include <crypto_parallel.h>
 #include <helpers/scalar_transcript_t.h>
 #include <signatures/signature.h>
 
@@ -56,6 +58,37 @@ namespace Crypto::Signature
         return (challenge - signature.LR.L).is_nonzero();
     }
 
+    bool check_signatures(
+        const std::vector<crypto_hash_t> &message_digests,
+        const std::vector<crypto_public_key_t> &public_keys,
+        const std::vector<crypto_signature_t> &signatures)
+    {
+        if (message_digests.size() != public_keys.size() || message_digests.size() != signatures.size())
+        {
+            return false;
+        }
+
+        std::atomic<bool> failed {false};
+
+        Crypto::Parallel::parallel_for(
+            0,
+            signatures.size(),
+            [&](size_t i)
+            {
+                if (failed)
+                {
+                    return;
+                }
+
+                if (!check_signature(message_digests[i], public_keys[i], signatures[i]))
+                {
+                    failed = true;
+                }
+            });
+
+        return !failed;
+    }
+
     crypto_signature_t complete_signature(const crypto_scalar_t &signing_scalar, const crypto_signature_t &signature)
     {
         SCALAR_OR_THROW(signing_scalar);
@@ -83,6 +116,33 @@ namespace Crypto::Signature
         return complete_signature(secret_key, signature);
     }
 
+    std::vector<crypto_signature_t>
+        generate_signatures(const std::vector<crypto_hash_t> &message_digests, const crypto_scalar_t &secret_key)
+    {
+        SCALAR_NZ_OR_THROW(secret_key);
+
+        // A = (a * G) mod l -- derived once for the entire batch
+        const auto public_key = secret_key * G;
+
+        std::vector<crypto_signature_t> results(message_digests.size());
+
+        /**
+         * Each message's nonce commitment (a fixed-base multiplication) and
+         * completion are independent so the batch streams across the pool
+         */
+        Crypto::Parallel::parallel_for(
+            0,
+            message_digests.size(),
+            [&](size_t i)
+            {
+                const auto signature = prepare_signature(message_digests[i], public_key);
+
+                results[i] = complete_signature(secret_key, signature);
+            });
+
+        return results;
+    }
+
     crypto_signature_t prepare_signature(const crypto_hash_t &message_digest, const crypto_public_key_t &public_key)
     {
     try_again:
@@ -0,0 +1,182 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * Emits crypto_constants_generated.h which bakes the domain-separated salt
+ * constants (normally derived at process startup via sha3_slow) and the
+ * leading range-proof generator vectors into static tables. Re-run this tool
+ * and commit the output whenever SALT_DOMAIN or the derivation scheme changes:
+ *
+ *     generate_constants [output_path]
+ *
+ * With no argument the header is written to stdout
+ */
+
+#include <crypto_constants.h>
+#include <fstream>
+#include <iostream>
+
+// the number of Gi/Hi generator pairs baked per range-proof scheme (4 outputs x 64 bits)
+static const size_t BAKED_GENERATOR_COUNT = 256;
+
+/**
+ * Emits a single named constant as the given structure type loaded from hex
+ * @param out
+ * @param name
+ * @param hex
+ * @param type
+ */
+static void emit_constant(std::ostream &out, const std::string &name, const std::string &hex, const std::string &type)
+{
+    out << "const auto " << name << " = " << type << "(\"" << hex << "\");" << std::endl << std::endl;
+}
+
+/**
+ * Emits the array of generator points for the given domain pair in the same
+ * order that generate_exponents() derives them at runtime
+ * @param out
+ * @param name
+ * @param domain_1
+ * @param domain_2
+ */
+static void
+    emit_generators(std::ostream &out, const std::string &name, const crypto_point_t &domain_1, const crypto_point_t &domain_2)
+{
+    std::vector<crypto_point_t> L, R;
+
+    auto writer = Serialization::serializer_t();
+
+    for (size_t i = 0; i < BAKED_GENERATOR_COUNT; ++i)
+    {
+        writer.reset();
+
+        writer.uint64(i);
+
+        writer.pod(domain_1);
+
+        L.push_back(crypto_hash_t::sha3(writer).point());
+
+        writer.pod(domain_2);
+
+        R.push_back(crypto_hash_t::sha3(writer).point());
+    }
+
+    for (const auto &[suffix, points] : {std::make_pair(std::string("_L"), L), std::make_pair(std::string("_R"), R)})
+    {
+        out << "static const char *const " << name << suffix << "[" << BAKED_GENERATOR_COUNT << "] = {" << std::endl;
+
+        for (const auto &point : points)
+        {
+            out << "    \"" << point.to_string() << "\"," << std::endl;
+        }
+
+        out << "};" << std::endl << std::endl;
+    }
+}
+
+static void emit_header(std::ostream &out)
+{
+    out << "// This file was generated by the generate_constants tool -- DO NOT EDIT" << std::endl
+        << "// It bakes the runtime-derived domain constants and the leading range-proof" << std::endl
+        << "// generator vectors into static tables so that nothing is re-derived at startup" << std::endl
+        << std::endl
+        << "#ifndef CRYPTO_CONSTANTS_GENERATED_H" << std::endl
+        << "#define CRYPTO_CONSTANTS_GENERATED_H" << std::endl
+        << std::endl;
+
+    emit_constant(out, "DERIVATION_DOMAIN_0", DERIVATION_DOMAIN_0.to_string(), "crypto_scalar_t");
+
+    emit_constant(out, "SPEND_KEY_DOMAIN_0", SPEND_KEY_DOMAIN_0.to_string(), "crypto_scalar_t");
+
+    emit_constant(out, "VIEW_KEY_DOMAIN_0", VIEW_KEY_DOMAIN_0.to_string(), "crypto_scalar_t");
+
+    emit_constant(out, "SIGNATURE_DOMAIN_0", SIGNATURE_DOMAIN_0.to_string(), "crypto_scalar_t");
+
+    emit_constant(out, "BORROMEAN_DOMAIN_0", BORROMEAN_DOMAIN_0.to_string(), "crypto_scalar_t");
+
+    emit_constant(out, "CLSAG_DOMAIN_0", CLSAG_DOMAIN_0.to_string(), "crypto_scalar_t");
+
+    emit_constant(out, "CLSAG_DOMAIN_1", CLSAG_DOMAIN_1.to_string(), "crypto_scalar_t");
+
+    emit_constant(out, "CLSAG_DOMAIN_2", CLSAG_DOMAIN_2.to_string(), "crypto_scalar_t");
+
+    emit_constant(out, "DOMAIN_COMMITMENT_MASK_0", DOMAIN_COMMITMENT_MASK_0.to_string(), "crypto_scalar_t");
+
+    emit_constant(out, "DOMAIN_AMOUNT_MASK_0", DOMAIN_AMOUNT_MASK_0.to_string(), "crypto_scalar_t");
+
+    emit_constant(out, "TRIPTYCH_DOMAIN_0", TRIPTYCH_DOMAIN_0.to_string(), "crypto_scalar_t");
+
+    emit_constant(out, "TRIPTYCH_DOMAIN_1", TRIPTYCH_DOMAIN_1.to_string(), "crypto_point_t");
+
+    emit_constant(out, "BULLETPROOFS_DOMAIN_0", BULLETPROOFS_DOMAIN_0.to_string(), "crypto_scalar_t");
+
+    emit_constant(out, "BULLETPROOFS_DOMAIN_1", BULLETPROOFS_DOMAIN_1.to_string(), "crypto_point_t");
+
+    emit_constant(out, "BULLETPROOFS_DOMAIN_2", BULLETPROOFS_DOMAIN_2.to_string(), "crypto_point_t");
+
+    emit_constant(out, "BULLETPROOFS_PLUS_DOMAIN_0", BULLETPROOFS_PLUS_DOMAIN_0.to_string(), "crypto_scalar_t");
+
+    emit_constant(out, "BULLETPROOFS_PLUS_DOMAIN_1", BULLETPROOFS_PLUS_DOMAIN_1.to_string(), "crypto_point_t");
+
+    emit_constant(out, "BULLETPROOFS_PLUS_DOMAIN_2", BULLETPROOFS_PLUS_DOMAIN_2.to_string(), "crypto_point_t");
+
+    emit_constant(out, "OUTPUT_PROOF_DOMAIN", OUTPUT_PROOF_DOMAIN.to_string(), "crypto_scalar_t");
+
+    emit_constant(out, "TRANSCRIPT_BASE", TRANSCRIPT_BASE.to_string(), "crypto_scalar_t");
+
+    out << "static const size_t BAKED_GENERATOR_COUNT = " << BAKED_GENERATOR_COUNT << ";" << std::endl << std::endl;
+
+    emit_generators(out, "BULLETPROOFS_GENERATORS", BULLETPROOFS_DOMAIN_1, BULLETPROOFS_DOMAIN_2);
+
+    emit_generators(out, "BULLETPROOFS_PLUS_GENERATORS", BULLETPROOFS_PLUS_DOMAIN_1, BULLETPROOFS_PLUS_DOMAIN_2);
+
+    out << "#endif // CRYPTO_CONSTANTS_GENERATED_H" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1)
+    {
+        std::ofstream file(argv[1], std::ios::trunc);
+
+        if (!file.good())
+        {
+            std::cerr << "Could not open " << argv[1] << " for writing" << std::endl;
+
+            return 1;
+        }
+
+        emit_header(file);
+
+        std::cout << "Wrote " << argv[1] << std::endl;
+    }
+    else
+    {
+        emit_header(std::cout);
+    }
+
+    return 0;
+}
@@ -24,6 +24,7 @@
 // STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <helpers/wire_codec.h>
 #include <types/crypto_borromean_signature_t.h>
 
 crypto_borromean_signature_t::crypto_borromean_signature_t(std::vector<crypto_signature_t> signatures):
@@ -88,6 +89,35 @@ void crypto_borromean_signature_t::deserialize(Serialization::deserializer_t &re
     SMART_CATCH(std::invalid_argument, "Could not deserialize crypto_borromean_signature_t");
 }
 
+void crypto_borromean_signature_t::from_bytes(const unsigned char *data, size_t length)
+{
+    try
+    {
+        auto cursor = data;
+
+        const auto end = data + length;
+
+        const auto count = WireCodec::read_varint(cursor, end);
+
+        if (size_t(end - cursor) < count * 64)
+        {
+            throw std::invalid_argument("Could not read signatures from wire data");
+        }
+
+        signatures.clear();
+
+        signatures.reserve(count);
+
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            signatures.emplace_back(std::vector<unsigned char>(cursor, cursor + 64));
+
+            cursor += 64;
+        }
+    }
+    SMART_CATCH(std::invalid_argument, "Could not deserialize crypto_borromean_signature_t");
+}
+
 void crypto_borromean_signature_t::deserialize(const std::vector<unsigned char> &data)
 {
     Serialization::deserializer_t reader(data);
@@ -139,6 +169,25 @@ std::vector<unsigned char> crypto_borromean_signature_t::serialize() const
     return writer.vector();
 }
 
+std::vector<uint8_t> crypto_borromean_signature_t::to_bytes() const
+{
+    std::vector<uint8_t> result;
+
+    result.reserve(WireCodec::varint_size(signatures.size()) + (signatures.size() * 64));
+
+    WireCodec::write_varint(result, signatures.size());
+
+    // each signature is its 64-byte L || R scalar pair back to back
+    for (const auto &signature : signatures)
+    {
+        WireCodec::write_pod(result, signature.LR.L);
+
+        WireCodec::write_pod(result, signature.LR.R);
+    }
+
+    return result;
+}
+
 size_t crypto_borromean_signature_t::size() const
 {
     return serialize().size();
@@ -27,6 +27,7 @@
 // Inspired by the work of Sarang Noether at
 // https://github.com/SarangNoether/skunkworks/tree/pybullet-plus
 
+#include <helpers/wire_codec.h>
 #include <types/crypto_bulletproof_plus_t.h>
 
 crypto_bulletproof_plus_t::crypto_bulletproof_plus_t(
@@ -138,6 +139,33 @@ void crypto_bulletproof_plus_t::deserialize(Serialization::deserializer_t &reade
     SMART_CATCH(std::invalid_argument, "Could not deserialize crypto_bulletproof_plus_t");
 }
 
+void crypto_bulletproof_plus_t::from_bytes(const unsigned char *data, size_t length)
+{
+    try
+    {
+        auto cursor = data;
+
+        const auto end = data + length;
+
+        A = WireCodec::read_pod<crypto_point_t>(cursor, end);
+
+        A1 = WireCodec::read_pod<crypto_point_t>(cursor, end);
+
+        B = WireCodec::read_pod<crypto_point_t>(cursor, end);
+
+        r1 = WireCodec::read_pod<crypto_scalar_t>(cursor, end);
+
+        s1 = WireCodec::read_pod<crypto_scalar_t>(cursor, end);
+
+        d1 = WireCodec::read_pod<crypto_scalar_t>(cursor, end);
+
+        L = WireCodec::read_pod_vector<crypto_point_t>(cursor, end);
+
+        R = WireCodec::read_pod_vector<crypto_point_t>(cursor, end);
+    }
+    SMART_CATCH(std::invalid_argument, "Could not deserialize crypto_bulletproof_plus_t");
+}
+
 void crypto_bulletproof_plus_t::fromJSON(const JSONValue &j)
 {
     try
@@ -210,6 +238,33 @@ std::vector<unsigned char> crypto_bulletproof_plus_t::serialize() const
     return writer.vector();
 }
 
+std::vector<uint8_t> crypto_bulletproof_plus_t::to_bytes() const
+{
+    std::vector<uint8_t> result;
+
+    result.reserve(
+        (6 * 32) + WireCodec::varint_size(L.size()) + (L.size() * 32) + WireCodec::varint_size(R.size())
+        + (R.size() * 32));
+
+    WireCodec::write_pod(result, A);
+
+    WireCodec::write_pod(result, A1);
+
+    WireCodec::write_pod(result, B);
+
+    WireCodec::write_pod(result, r1);
+
+    WireCodec::write_pod(result, s1);
+
+    WireCodec::write_pod(result, d1);
+
+    WireCodec::write_pod_vector(result, L);
+
+    WireCodec::write_pod_vector(result, R);
+
+    return result;
+}
+
 size_t crypto_bulletproof_plus_t::size() const
 {
     return serialize().size();
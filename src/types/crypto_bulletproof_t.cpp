@@ -27,6 +27,7 @@
 // Inspired by the work of Sarang Noether at
 // https://github.com/SarangNoether/skunkworks/tree/pybullet
 
+#include <helpers/wire_codec.h>
 #include <types/crypto_bulletproof_t.h>
 
 crypto_bulletproof_t::crypto_bulletproof_t(
@@ -147,6 +148,39 @@ void crypto_bulletproof_t::deserialize(Serialization::deserializer_t &reader)
     SMART_CATCH(std::invalid_argument, "Could not deserialize crypto_bulletproof_t");
 }
 
+void crypto_bulletproof_t::from_bytes(const unsigned char *data, size_t length)
+{
+    try
+    {
+        auto cursor = data;
+
+        const auto end = data + length;
+
+        A = WireCodec::read_pod<crypto_point_t>(cursor, end);
+
+        S = WireCodec::read_pod<crypto_point_t>(cursor, end);
+
+        T1 = WireCodec::read_pod<crypto_point_t>(cursor, end);
+
+        T2 = WireCodec::read_pod<crypto_point_t>(cursor, end);
+
+        taux = WireCodec::read_pod<crypto_scalar_t>(cursor, end);
+
+        mu = WireCodec::read_pod<crypto_scalar_t>(cursor, end);
+
+        L = WireCodec::read_pod_vector<crypto_point_t>(cursor, end);
+
+        R = WireCodec::read_pod_vector<crypto_point_t>(cursor, end);
+
+        g = WireCodec::read_pod<crypto_scalar_t>(cursor, end);
+
+        h = WireCodec::read_pod<crypto_scalar_t>(cursor, end);
+
+        t = WireCodec::read_pod<crypto_scalar_t>(cursor, end);
+    }
+    SMART_CATCH(std::invalid_argument, "Could not deserialize crypto_bulletproof_t");
+}
+
 void crypto_bulletproof_t::fromJSON(const JSONValue &j)
 {
     try
@@ -231,6 +265,39 @@ std::vector<unsigned char> crypto_bulletproof_t::serialize() const
     return writer.vector();
 }
 
+std::vector<uint8_t> crypto_bulletproof_t::to_bytes() const
+{
+    std::vector<uint8_t> result;
+
+    result.reserve(
+        (9 * 32) + WireCodec::varint_size(L.size()) + (L.size() * 32) + WireCodec::varint_size(R.size())
+        + (R.size() * 32));
+
+    WireCodec::write_pod(result, A);
+
+    WireCodec::write_pod(result, S);
+
+    WireCodec::write_pod(result, T1);
+
+    WireCodec::write_pod(result, T2);
+
+    WireCodec::write_pod(result, taux);
+
+    WireCodec::write_pod(result, mu);
+
+    WireCodec::write_pod_vector(result, L);
+
+    WireCodec::write_pod_vector(result, R);
+
+    WireCodec::write_pod(result, g);
+
+    WireCodec::write_pod(result, h);
+
+    WireCodec::write_pod(result, t);
+
+    return result;
+}
+
 size_t crypto_bulletproof_t::size() const
 {
     return serialize().size();
@@ -27,6 +27,7 @@
 // Inspired by the work of Sarang Noether found at
 // https://github.com/SarangNoether/skunkworks/tree/clsag
 
+#include <helpers/wire_codec.h>
 #include <types/crypto_clsag_signature_t.h>
 
 crypto_clsag_signature_t::crypto_clsag_signature_t(
@@ -99,6 +100,34 @@ bool crypto_clsag_signature_t::check_construction(size_t ring_size, bool use_com
     return true;
 }
 
+bool crypto_clsag_signature_t::pre_screen(size_t ring_size, bool use_commitments) const
+{
+    if (ring_size == 0 || scalars.size() != ring_size)
+    {
+        return false;
+    }
+
+    if (!challenge.valid())
+    {
+        return false;
+    }
+
+    for (const auto &scalar : scalars)
+    {
+        if (!scalar.valid())
+        {
+            return false;
+        }
+    }
+
+    if (use_commitments && (!commitment_image.valid() || !pseudo_commitment.valid()))
+    {
+        return false;
+    }
+
+    return true;
+}
+
 void crypto_clsag_signature_t::deserialize(const std::vector<unsigned char> &data)
 {
     Serialization::deserializer_t reader(data);
@@ -124,6 +153,28 @@ void crypto_clsag_signature_t::deserialize(Serialization::deserializer_t &reader
     SMART_CATCH(std::invalid_argument, "Could not deserialize crypto_clsag_signature_t");
 }
 
+void crypto_clsag_signature_t::from_bytes(const unsigned char *data, size_t length)
+{
+    try
+    {
+        auto cursor = data;
+
+        const auto end = data + length;
+
+        scalars = WireCodec::read_pod_vector<crypto_scalar_t>(cursor, end);
+
+        challenge = WireCodec::read_pod<crypto_scalar_t>(cursor, end);
+
+        if (WireCodec::read_varint(cursor, end) != 0)
+        {
+            commitment_image = WireCodec::read_pod<crypto_key_image_t>(cursor, end);
+
+            pseudo_commitment = WireCodec::read_pod<crypto_pedersen_commitment_t>(cursor, end);
+        }
+    }
+    SMART_CATCH(std::invalid_argument, "Could not deserialize crypto_clsag_signature_t");
+}
+
 void crypto_clsag_signature_t::fromJSON(const JSONValue &j)
 {
     try
@@ -191,6 +242,31 @@ std::vector<unsigned char> crypto_clsag_signature_t::serialize() const
     return writer.vector();
 }
 
+std::vector<uint8_t> crypto_clsag_signature_t::to_bytes() const
+{
+    const auto with_commitments = commitment_image.valid();
+
+    std::vector<uint8_t> result;
+
+    result.reserve(
+        WireCodec::varint_size(scalars.size()) + (scalars.size() * 32) + 32 + 1 + (with_commitments ? 64 : 0));
+
+    WireCodec::write_pod_vector(result, scalars);
+
+    WireCodec::write_pod(result, challenge);
+
+    WireCodec::write_varint(result, with_commitments ? 1 : 0);
+
+    if (with_commitments)
+    {
+        WireCodec::write_pod(result, commitment_image);
+
+        WireCodec::write_pod(result, pseudo_commitment);
+    }
+
+    return result;
+}
+
 size_t crypto_clsag_signature_t::size() const
 {
     return serialize().size();
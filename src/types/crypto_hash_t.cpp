@@ -25,6 +25,8 @@
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <crypto_config.h>
+#include <crypto_parallel.h>
+#include <crypto_stats.h>
 #include <cryptopp/blake2.h>
 #include <cryptopp/sha.h>
 #include <cryptopp/sha3.h>
@@ -53,6 +55,97 @@ static void init_argon2()
     }
 }
 
+/**
+ * The argon2 memory arena is pinned per thread and handed back to the library
+ * through its allocator callbacks, so repeated hashing at a fixed memory cost
+ * reuses the same (already faulted-in) arena instead of re-allocating hundreds
+ * of megabytes per call
+ */
+static thread_local std::vector<uint8_t> argon2_arena;
+
+static int argon2_arena_allocate(uint8_t **memory, size_t bytes_to_allocate)
+{
+    if (argon2_arena.size() < bytes_to_allocate)
+    {
+        argon2_arena.resize(bytes_to_allocate);
+    }
+
+    *memory = argon2_arena.data();
+
+    return 0;
+}
+
+static void argon2_arena_deallocate(uint8_t *memory, size_t bytes_to_allocate)
+{
+    // the arena is deliberately retained for the next invocation on this thread
+    (void)memory;
+
+    (void)bytes_to_allocate;
+}
+
+/**
+ * Runs the requested argon2 variant through a context that pins the memory
+ * arena across calls; lane parallelism is driven by the library itself when
+ * more than one thread is requested
+ * @param type
+ * @param input
+ * @param length
+ * @param salt
+ * @param salt_length
+ * @param iterations
+ * @param memory
+ * @param threads
+ * @return
+ */
+static crypto_hash_t argon2_hash_pinned(
+    argon2_type type,
+    const void *input,
+    size_t length,
+    const void *salt,
+    size_t salt_length,
+    size_t iterations,
+    size_t memory,
+    size_t threads)
+{
+    init_argon2();
+
+    crypto_hash_t result;
+
+    argon2_context context = {};
+
+    context.out = *result;
+
+    context.outlen = uint32_t(result.size());
+
+    context.pwd = const_cast<uint8_t *>(static_cast<const uint8_t *>(input));
+
+    context.pwdlen = uint32_t(length);
+
+    context.salt = const_cast<uint8_t *>(static_cast<const uint8_t *>(salt));
+
+    context.saltlen = uint32_t(salt_length);
+
+    context.t_cost = uint32_t(iterations);
+
+    context.m_cost = uint32_t(memory);
+
+    context.lanes = uint32_t(threads);
+
+    context.threads = uint32_t(threads);
+
+    context.version = ARGON2_VERSION_NUMBER;
+
+    context.allocate_cbk = argon2_arena_allocate;
+
+    context.free_cbk = argon2_arena_deallocate;
+
+    context.flags = ARGON2_DEFAULT_FLAGS;
+
+    argon2_ctx(&context, type);
+
+    return result;
+}
+
 crypto_hash_t::crypto_hash_t(std::initializer_list<unsigned char> input)
 {
     std::copy(input.begin(), input.end(), std::begin(bytes));
@@ -79,13 +172,7 @@ crypto_hash_t crypto_hash_t::argon2d(
     size_t memory,
     size_t threads)
 {
-    init_argon2();
-
-    crypto_hash_t result;
-
-    argon2d_hash_raw(iterations, memory, threads, input, length, salt, salt_length, *result, result.size());
-
-    return result;
+    return argon2_hash_pinned(Argon2_d, input, length, salt, salt_length, iterations, memory, threads);
 }
 
 crypto_hash_t crypto_hash_t::argon2i(
@@ -97,13 +184,7 @@ crypto_hash_t crypto_hash_t::argon2i(
     size_t memory,
     size_t threads)
 {
-    init_argon2();
-
-    crypto_hash_t result;
-
-    argon2i_hash_raw(iterations, memory, threads, input, length, salt, salt_length, *result, result.size());
-
-    return result;
+    return argon2_hash_pinned(Argon2_i, input, length, salt, salt_length, iterations, memory, threads);
 }
 
 crypto_hash_t crypto_hash_t::argon2id(
@@ -115,26 +196,26 @@ crypto_hash_t crypto_hash_t::argon2id(
     size_t memory,
     size_t threads)
 {
-    init_argon2();
-
-    crypto_hash_t result;
-
-    argon2id_hash_raw(iterations, memory, threads, input, length, salt, salt_length, *result, result.size());
-
-    return result;
+    return argon2_hash_pinned(Argon2_id, input, length, salt, salt_length, iterations, memory, threads);
 }
 
 crypto_hash_t crypto_hash_t::blake2b(const void *input, size_t length)
 {
     crypto_hash_t result;
 
-    auto hash_context = new CryptoPP::BLAKE2b(false, static_cast<unsigned int>(result.size()));
+    /**
+     * The hashing context is restarted and reused across every call on the
+     * thread (the underlying implementation already selects its fastest
+     * vectorized compression function for the host CPU at runtime), so bulk
+     * content-addressing never pays a context construction per message
+     */
+    static thread_local CryptoPP::BLAKE2b hash_context(false, 32u);
 
-    hash_context->Update(static_cast<const CryptoPP::byte *>(input), length);
+    hash_context.Restart();
 
-    hash_context->TruncatedFinal(*result, result.size());
+    hash_context.Update(static_cast<const CryptoPP::byte *>(input), length);
 
-    free(hash_context);
+    hash_context.TruncatedFinal(*result, result.size());
 
     return result;
 }
@@ -178,22 +259,38 @@ std::vector<crypto_hash_t> crypto_hash_t::random(size_t count)
 
 crypto_hash_t crypto_hash_t::sha3(const void *input, size_t length)
 {
+    CRYPTO_STATS_COUNT(sha3_hashes)
+
     crypto_hash_t result;
 
-    const auto hash_context = new CryptoPP::SHA3_256();
+    /**
+     * The hashing context is restarted and reused across every call on the
+     * thread; the SHA-3 state is tiny and this keeps the hottest hashing path
+     * in the library from paying a heap allocation per message. The underlying
+     * implementation already selects the fastest Keccak permutation available
+     * for the host CPU at runtime.
+     */
+    static thread_local CryptoPP::SHA3_256 hash_context;
 
-    hash_context->Update(static_cast<const CryptoPP::byte *>(input), length);
+    hash_context.Restart();
 
-    hash_context->TruncatedFinal(*result, result.size());
+    hash_context.Update(static_cast<const CryptoPP::byte *>(input), length);
 
-    free(hash_context);
+    hash_context.TruncatedFinal(*result, result.size());
 
     return result;
 }
 
 crypto_hash_t crypto_hash_t::sha3_slow(const void *input, size_t length, uint64_t iterations)
 {
-    Serialization::serializer_t writer;
+    /**
+     * The iteration scratch (this serializer plus the hashing context inside
+     * sha3) is thread-local and reused across calls, so PoW-style repeated
+     * invocation never touches the allocator and stays cache-warm
+     */
+    static thread_local Serialization::serializer_t writer;
+
+    writer.reset();
 
     auto result = crypto_hash_t::sha3(input, length);
 
@@ -280,6 +377,22 @@ crypto_point_t crypto_hash_t::point() const
     return crypto_point_t::reduce(this->data());
 }
 
+std::vector<crypto_point_t> crypto_hash_t::points(const std::vector<crypto_hash_t> &hashes)
+{
+    std::vector<crypto_point_t> result(hashes.size());
+
+    /**
+     * Each reduction is independent so the batch fans out across the worker
+     * pool; the field inversion inside the mapping is fused into its
+     * square-root exponentiation chain in this curve implementation, so there
+     * is no standalone inversion for the Montgomery trick to collect and the
+     * amortization comes from the pool instead
+     */
+    Crypto::Parallel::parallel_for(0, hashes.size(), [&](size_t i) { result[i] = hashes[i].point(); });
+
+    return result;
+}
+
 crypto_scalar_t crypto_hash_t::scalar() const
 {
     return crypto_scalar_t(this->serialize(), true);
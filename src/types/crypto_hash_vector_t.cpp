@@ -24,6 +24,8 @@
 // STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <helpers/dedupe_and_sort_keys.h>
+#include <helpers/wire_codec.h>
 #include <types/crypto_hash_vector_t.h>
 #include <utility>
 
@@ -31,3 +33,94 @@ crypto_hash_vector_t::crypto_hash_vector_t(std::vector<crypto_hash_t> hashes)
 {
     container = std::move(hashes);
 }
+
+void crypto_hash_vector_t::from_bytes(const unsigned char *data, size_t length)
+{
+    try
+    {
+        auto cursor = data;
+
+        const auto end = data + length;
+
+        container = WireCodec::read_pod_vector<crypto_hash_t>(cursor, end);
+    }
+    SMART_CATCH(std::invalid_argument, "Could not deserialize crypto_hash_vector_t");
+}
+
+std::vector<uint8_t> crypto_hash_vector_t::to_bytes() const
+{
+    std::vector<uint8_t> result;
+
+    result.reserve(WireCodec::varint_size(container.size()) + (container.size() * 32));
+
+    WireCodec::write_pod_vector(result, container);
+
+    return result;
+}
+
+bool crypto_hash_vector_t::contains_duplicates() const
+{
+    if (container.size() < 2)
+    {
+        return false;
+    }
+
+    auto sorted = container;
+
+    radix_sort_keys(sorted, 0, sorted.size(), 0);
+
+    for (size_t i = 1; i < sorted.size(); ++i)
+    {
+        // 32-byte equality compiles down to a handful of wide compares
+        if (std::memcmp(sorted[i - 1].data(), sorted[i].data(), 32) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+crypto_hash_vector_t crypto_hash_vector_t::intersect(const crypto_hash_vector_t &other) const
+{
+    auto left = container, right = other.container;
+
+    dedupe_and_sort_keys_in_place(left);
+
+    dedupe_and_sort_keys_in_place(right);
+
+    std::vector<crypto_hash_t> result;
+
+    size_t i = 0, j = 0;
+
+    // both sides share the radix ordering so one merge walk finds the overlap
+    while (i < left.size() && j < right.size())
+    {
+        const auto comparison = std::memcmp(left[i].data(), right[j].data(), 32);
+
+        if (comparison == 0)
+        {
+            result.push_back(left[i]);
+
+            ++i;
+
+            ++j;
+        }
+        else if (comparison > 0)
+        {
+            // the radix ordering is descending so the larger value advances
+            ++i;
+        }
+        else
+        {
+            ++j;
+        }
+    }
+
+    return crypto_hash_vector_t(result);
+}
+
+void crypto_hash_vector_t::sort()
+{
+    radix_sort_keys(container, 0, container.size(), 0);
+}
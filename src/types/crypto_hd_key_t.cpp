@@ -24,6 +24,7 @@
 // STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <crypto_parallel.h>
 #include <cryptopp/sha.h>
 #include <helpers/hd_keys.h>
 #include <types/crypto_hd_key_t.h>
@@ -115,6 +116,80 @@ crypto_hd_key_t crypto_hd_key_t::generate_child_key(const std::string &path) con
     return crypto_hd_key_t(child_key, child_chain_code);
 }
 
+crypto_hd_key_t crypto_hd_key_t::generate_child_key(const std::vector<uint32_t> &parsed_path) const
+{
+    const auto [child_key, child_chain_code] = generate_hd_child_key(_key, _chain_code, parsed_path);
+
+    return crypto_hd_key_t(child_key, child_chain_code);
+}
+
+std::vector<std::vector<crypto_hd_key_t>> crypto_hd_key_t::export_subtree(
+    const size_t purpose,
+    const size_t coin_type,
+    const size_t account,
+    const size_t change_count,
+    const size_t address_count) const
+{
+    // the shared account prefix is walked exactly once
+    const auto account_node = generate_child_key(purpose, coin_type, account);
+
+    std::vector<std::vector<crypto_hd_key_t>> result(change_count);
+
+    /**
+     * The change branches are independent subtrees so each derives its whole
+     * address range on its own worker from the cached account node
+     */
+    Crypto::Parallel::parallel_for(
+        0,
+        change_count,
+        [&](size_t change)
+        {
+            const auto change_node = account_node.generate_child_key(std::vector<uint32_t>(1, uint32_t(change) + 0x80000000));
+
+            auto &branch = result[change];
+
+            branch.reserve(address_count);
+
+            for (size_t index = 0; index < address_count; ++index)
+            {
+                branch.push_back(change_node.generate_child_key(std::vector<uint32_t>(1, uint32_t(index) + 0x80000000)));
+            }
+        });
+
+    return result;
+}
+
+std::vector<crypto_hd_key_t> crypto_hd_key_t::generate_child_keys(
+    const size_t purpose,
+    const size_t coin_type,
+    const size_t account,
+    const size_t change,
+    const size_t start_index,
+    const size_t count) const
+{
+    /**
+     * Each level of the hardened derivation depends only on its parent node so
+     * the shared prefix is walked a single time and every address index in the
+     * range derives just its final level from the cached parent
+     */
+    const auto parent = generate_child_key(purpose, coin_type, account, change);
+
+    std::vector<crypto_hd_key_t> result;
+
+    result.reserve(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const auto path = make_bip32_path(start_index + i);
+
+        const auto [child_key, child_chain_code] = generate_hd_child_key(parent._key, parent._chain_code, path);
+
+        result.emplace_back(child_key, child_chain_code);
+    }
+
+    return result;
+}
+
 crypto_hash_t crypto_hd_key_t::key() const
 {
     return _key;
@@ -25,6 +25,7 @@
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <crypto_config.h>
+#include <crypto_stats.h>
 #include <cryptopp/sha3.h>
 #include <helpers/random_bytes.h>
 #include <types/crypto_point_t.h>
@@ -76,6 +77,9 @@ crypto_point_t::crypto_point_t(const ge_p3 &point): point3(point)
     ge_p3_tobytes(bytes, &point);
 
     ge_p3_to_cached(&cached_point, &point3);
+
+    // arithmetic results are valid curve points by construction
+    validated = true;
 }
 
 crypto_point_t::crypto_point_t(const uint64_t &number)
@@ -105,6 +109,8 @@ crypto_point_t crypto_point_t::from_uint256(const uint256_t &number)
 
 crypto_point_t crypto_point_t::operator+(const crypto_point_t &other) const
 {
+    CRYPTO_STATS_COUNT(point_additions)
+
     ge_p1p1 tmp2;
 
     // AB = (a + b) mod l
@@ -155,18 +161,34 @@ ge_cached crypto_point_t::cached() const
 
 bool crypto_point_t::check() const
 {
+    // a point that already decompressed successfully needs no second pass
+    if (validated)
+    {
+        return true;
+    }
+
     ge_p3 tmp;
 
-    return ge_frombytes_negate_vartime(&tmp, bytes) == 0;
+    validated = ge_frombytes_negate_vartime(&tmp, bytes) == 0;
+
+    return validated;
 }
 
 bool crypto_point_t::check_subgroup() const
 {
+    // a point that already passed the subgroup check never re-pays for it
+    if (subgroup_validated)
+    {
+        return true;
+    }
+
     ge_dsmp tmp;
 
     ge_dsm_precomp(tmp, &point3);
 
-    return ge_check_subgroup_precomp_negate_vartime(tmp) == 0 && !empty();
+    subgroup_validated = ge_check_subgroup_precomp_negate_vartime(tmp) == 0 && !empty();
+
+    return subgroup_validated;
 }
 
 bool crypto_point_t::empty() const
@@ -174,6 +196,16 @@ bool crypto_point_t::empty() const
     return *this == crypto_point_t();
 }
 
+bool crypto_point_t::is_identity() const
+{
+    // the identity is (0, 1): in projective terms X == 0 and Y == Z
+    fe difference;
+
+    fe_sub(difference, point3.Y, point3.Z);
+
+    return fe_isnonzero(point3.X) == 0 && fe_isnonzero(difference) == 0;
+}
+
 crypto_point_t crypto_point_t::mul8() const
 {
     ge_p1p1 tmp;
@@ -295,10 +327,17 @@ bool crypto_point_t::valid(bool allow_identity) const
 
 void crypto_point_t::load_hook()
 {
+    CRYPTO_STATS_COUNT(point_decompressions)
+
     if (ge_frombytes_negate_vartime(&point3, bytes) != 0)
     {
         throw std::runtime_error("could not load point");
     }
 
     ge_p3_to_cached(&cached_point, &point3);
+
+    validated = true;
+
+    // the previous bytes' subgroup result must not survive a reload
+    subgroup_validated = false;
 }
@@ -25,6 +25,7 @@
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <helpers/dedupe_and_sort_keys.h>
+#include <helpers/wire_codec.h>
 #include <types/crypto_point_vector_t.h>
 #include <utility>
 
@@ -131,6 +132,19 @@ crypto_point_vector_t crypto_point_vector_t::slice(size_t start, size_t end) con
     return crypto_point_vector_t(std::vector<crypto_point_t>(container.begin() + start, container.begin() + end));
 }
 
+bool crypto_point_vector_t::all_identity() const
+{
+    for (const auto &point : container)
+    {
+        if (!point.is_identity())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 crypto_point_t crypto_point_vector_t::sum() const
 {
     auto result = Crypto::Z;
@@ -142,3 +156,63 @@ crypto_point_t crypto_point_vector_t::sum() const
 
     return result;
 }
+
+bool crypto_point_vector_t::valid(bool allow_identity) const
+{
+    for (const auto &point : container)
+    {
+        if (!point.valid(allow_identity))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::tuple<bool, crypto_point_vector_t> crypto_point_vector_t::load(const unsigned char *data, size_t count)
+{
+    crypto_point_vector_t result;
+
+    result.container.reserve(count);
+
+    try
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            result.append(crypto_point_t(std::vector<unsigned char>(data + (i * 32), data + ((i + 1) * 32))));
+        }
+    }
+    catch (const std::exception &e)
+    {
+        PRINTF(e.what())
+
+        return {false, {}};
+    }
+
+    return {true, result};
+}
+
+void crypto_point_vector_t::from_bytes(const unsigned char *data, size_t length)
+{
+    try
+    {
+        auto cursor = data;
+
+        const auto end = data + length;
+
+        container = WireCodec::read_pod_vector<crypto_point_t>(cursor, end);
+    }
+    SMART_CATCH(std::invalid_argument, "Could not deserialize crypto_point_vector_t");
+}
+
+std::vector<uint8_t> crypto_point_vector_t::to_bytes() const
+{
+    std::vector<uint8_t> result;
+
+    result.reserve(WireCodec::varint_size(container.size()) + (container.size() * 32));
+
+    WireCodec::write_pod_vector(result, container);
+
+    return result;
+}
@@ -25,7 +25,9 @@
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <crypto_config.h>
+#include <crypto_stats.h>
 #include <cryptopp/sha3.h>
+#include <helpers/fixed_base_table_t.h>
 #include <helpers/random_bytes.h>
 #include <types/crypto_scalar_t.h>
 
@@ -99,6 +101,20 @@ crypto_scalar_t::crypto_scalar_t(const std::vector<crypto_scalar_t> &bits, bool
     }
 }
 
+crypto_scalar_t crypto_scalar_t::from_limbs(const uint64_t limbs[4], bool reduce)
+{
+    crypto_scalar_t result;
+
+    std::memcpy(result.bytes, limbs, sizeof(result.bytes));
+
+    if (reduce)
+    {
+        return result.reduce();
+    }
+
+    return result;
+}
+
 crypto_scalar_t crypto_scalar_t::from_uint256(const uint256_t &number, bool reduce)
 {
     unsigned char bytes[32];
@@ -399,6 +415,8 @@ void crypto_scalar_t::operator/=(const uint256_t &other)
 
 crypto_point_t crypto_scalar_t::operator*(const crypto_point_t &point) const
 {
+    CRYPTO_STATS_COUNT(scalar_mults)
+
     ge_p3 temp_p3;
 
     ge_p1p1 temp_p1p1;
@@ -411,6 +429,10 @@ crypto_point_t crypto_scalar_t::operator*(const crypto_point_t &point) const
 
         return crypto_point_t(temp_p3);
     }
+    else if (point == Crypto::H) // H is fixed so the precomputed table beats the variable-base ladder
+    {
+        return Crypto::H_table().mul(*this);
+    }
     else
     {
         const auto p = point.p3();
@@ -427,10 +449,29 @@ crypto_point_t crypto_scalar_t::operator*(const crypto_point_t &point) const
 crypto_point_t
     crypto_scalar_t::dbl_mult(const crypto_point_t &A, const crypto_scalar_t &b, const crypto_point_t &B) const
 {
+    CRYPTO_STATS_COUNT(double_scalar_mults)
+
     ge_p1p1 temp_p1p1;
 
     ge_p3 temp_p3;
 
+    /**
+     * The Pedersen-commitment-shaped pair (H, G) is by far the most frequent
+     * double multiplication in the library and both bases are fixed, so it
+     * rides the joint precomputed tables rather than the generic routine
+     */
+    if (A == Crypto::H && B == Crypto::G)
+    {
+        const auto point = Crypto::H_table().dbl_mult(*this, Crypto::G_table(), b);
+
+        if (point != Crypto::ZP)
+        {
+            return point;
+        }
+
+        return Crypto::Z;
+    }
+
     if (B == Crypto::G)
     {
         temp_p3 = A.p3();
@@ -540,34 +581,48 @@ crypto_scalar_t crypto_scalar_t::powm(const crypto_scalar_t &exponent, size_t mo
 }
 
 std::vector<crypto_scalar_t> crypto_scalar_t::pow_expand(size_t count, bool descending, bool include_zero) const
+{
+    std::vector<crypto_scalar_t> result;
+
+    pow_expand(count, result, descending, include_zero);
+
+    return result;
+}
+
+void crypto_scalar_t::pow_expand(size_t count, std::vector<crypto_scalar_t> &result, bool descending, bool include_zero)
+    const
 {
     if (count == 0)
     {
         throw std::invalid_argument("count should be non-zero");
     }
 
-    std::vector<crypto_scalar_t> result(count);
+    result.resize(count);
 
-    size_t start = 0, end = count;
+    /**
+     * The powers roll out as two interleaved multiply chains stepping by the
+     * square of the scalar: each element depends only on the element two
+     * positions back, so the chains proceed independently instead of one
+     * serial multiply dependency per element, at one multiplication each
+     */
+    result[0] = include_zero ? crypto_scalar_t(1) : *this;
 
-    if (!include_zero)
+    if (count > 1)
     {
-        start += 1;
+        result[1] = result[0] * *this;
 
-        end += 1;
-    }
+        const auto stride = squared();
 
-    for (size_t i = start, j = 0; i < end; ++i, ++j)
-    {
-        result[j] = pow(i);
+        for (size_t j = 2; j < count; ++j)
+        {
+            result[j] = result[j - 2] * stride;
+        }
     }
 
     if (descending)
     {
         std::reverse(result.begin(), result.end());
     }
-
-    return result;
 }
 
 crypto_scalar_t crypto_scalar_t::pow_sum(size_t count) const
@@ -628,11 +683,32 @@ std::vector<crypto_scalar_t> crypto_scalar_t::random(size_t count)
 {
     std::vector<crypto_scalar_t> result(count);
 
+    /**
+     * One wide draw supplies the entropy for the whole batch and each scalar
+     * is then derived from its own slice exactly as the single-scalar path
+     * derives from a fresh draw (hash then reduce) in one tight loop
+     */
+    std::vector<unsigned char> entropy(count * CRYPTO_ENTROPY_BYTES);
+
+    random_bytes(entropy.size(), entropy.data());
+
+    SerializablePod hash;
+
+    auto hash_context = new CryptoPP::SHA3_256();
+
     for (size_t i = 0; i < count; ++i)
     {
-        result[i] = crypto_scalar_t::random();
+        hash_context->Update(static_cast<CryptoPP::byte *>(entropy.data() + (i * CRYPTO_ENTROPY_BYTES)), CRYPTO_ENTROPY_BYTES);
+
+        hash_context->TruncatedFinal(*hash, hash.size());
+
+        result[i] = crypto_scalar_t(hash.serialize(), true);
     }
 
+    free(hash_context);
+
+    secure_erase(entropy.data(), entropy.size());
+
     return result;
 }
 
@@ -695,6 +771,20 @@ std::vector<crypto_scalar_t> crypto_scalar_t::to_bits(size_t bits) const
     return result;
 }
 
+uint64_t crypto_scalar_t::limb(size_t index) const
+{
+    if (index >= 4)
+    {
+        throw std::range_error("a scalar carries exactly four 64-bit limbs");
+    }
+
+    uint64_t result;
+
+    std::memcpy(&result, bytes + (index * sizeof(result)), sizeof(result));
+
+    return result;
+}
+
 uint64_t crypto_scalar_t::to_uint64_t() const
 {
     uint64_t result;
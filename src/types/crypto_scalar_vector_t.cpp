@@ -25,6 +25,8 @@
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <helpers/dedupe_and_sort_keys.h>
+#include <helpers/multiexp.h>
+#include <helpers/wire_codec.h>
 #include <types/crypto_scalar_vector_t.h>
 #include <utility>
 
@@ -38,7 +40,7 @@ crypto_scalar_vector_t::crypto_scalar_vector_t(size_t size, const crypto_scalar_
     container = std::vector<crypto_scalar_t>(size, value);
 }
 
-crypto_scalar_vector_t crypto_scalar_vector_t::operator+(const crypto_scalar_t &other) const
+crypto_scalar_vector_t crypto_scalar_vector_t::operator+(const crypto_scalar_t &other) const &
 {
     std::vector<crypto_scalar_t> result(container);
 
@@ -50,7 +52,17 @@ crypto_scalar_vector_t crypto_scalar_vector_t::operator+(const crypto_scalar_t &
     return crypto_scalar_vector_t(result);
 }
 
-crypto_scalar_vector_t crypto_scalar_vector_t::operator+(const crypto_scalar_vector_t &other) const
+crypto_scalar_vector_t crypto_scalar_vector_t::operator+(const crypto_scalar_t &other) &&
+{
+    for (auto &val : container)
+    {
+        val += other;
+    }
+
+    return crypto_scalar_vector_t(std::move(container));
+}
+
+crypto_scalar_vector_t crypto_scalar_vector_t::operator+(const crypto_scalar_vector_t &other) const &
 {
     if (container.size() != other.container.size())
     {
@@ -67,7 +79,22 @@ crypto_scalar_vector_t crypto_scalar_vector_t::operator+(const crypto_scalar_vec
     return crypto_scalar_vector_t(result);
 }
 
-crypto_scalar_vector_t crypto_scalar_vector_t::operator-(const crypto_scalar_t &other) const
+crypto_scalar_vector_t crypto_scalar_vector_t::operator+(const crypto_scalar_vector_t &other) &&
+{
+    if (container.size() != other.container.size())
+    {
+        throw std::range_error("vectors must be of the same size");
+    }
+
+    for (size_t i = 0; i < container.size(); ++i)
+    {
+        container[i] += other.container[i];
+    }
+
+    return crypto_scalar_vector_t(std::move(container));
+}
+
+crypto_scalar_vector_t crypto_scalar_vector_t::operator-(const crypto_scalar_t &other) const &
 {
     std::vector<crypto_scalar_t> result(container);
 
@@ -79,7 +106,17 @@ crypto_scalar_vector_t crypto_scalar_vector_t::operator-(const crypto_scalar_t &
     return crypto_scalar_vector_t(result);
 }
 
-crypto_scalar_vector_t crypto_scalar_vector_t::operator-(const crypto_scalar_vector_t &other) const
+crypto_scalar_vector_t crypto_scalar_vector_t::operator-(const crypto_scalar_t &other) &&
+{
+    for (auto &val : container)
+    {
+        val -= other;
+    }
+
+    return crypto_scalar_vector_t(std::move(container));
+}
+
+crypto_scalar_vector_t crypto_scalar_vector_t::operator-(const crypto_scalar_vector_t &other) const &
 {
     if (container.size() != other.container.size())
     {
@@ -96,7 +133,22 @@ crypto_scalar_vector_t crypto_scalar_vector_t::operator-(const crypto_scalar_vec
     return crypto_scalar_vector_t(result);
 }
 
-crypto_scalar_vector_t crypto_scalar_vector_t::operator*(const crypto_scalar_t &other) const
+crypto_scalar_vector_t crypto_scalar_vector_t::operator-(const crypto_scalar_vector_t &other) &&
+{
+    if (container.size() != other.container.size())
+    {
+        throw std::range_error("vectors must be of the same size");
+    }
+
+    for (size_t i = 0; i < container.size(); ++i)
+    {
+        container[i] -= other.container[i];
+    }
+
+    return crypto_scalar_vector_t(std::move(container));
+}
+
+crypto_scalar_vector_t crypto_scalar_vector_t::operator*(const crypto_scalar_t &other) const &
 {
     std::vector<crypto_scalar_t> result(container);
 
@@ -108,7 +160,17 @@ crypto_scalar_vector_t crypto_scalar_vector_t::operator*(const crypto_scalar_t &
     return crypto_scalar_vector_t(result);
 }
 
-crypto_scalar_vector_t crypto_scalar_vector_t::operator*(const crypto_scalar_vector_t &other) const
+crypto_scalar_vector_t crypto_scalar_vector_t::operator*(const crypto_scalar_t &other) &&
+{
+    for (auto &val : container)
+    {
+        val *= other;
+    }
+
+    return crypto_scalar_vector_t(std::move(container));
+}
+
+crypto_scalar_vector_t crypto_scalar_vector_t::operator*(const crypto_scalar_vector_t &other) const &
 {
     if (container.size() != other.container.size())
     {
@@ -125,6 +187,21 @@ crypto_scalar_vector_t crypto_scalar_vector_t::operator*(const crypto_scalar_vec
     return crypto_scalar_vector_t(result);
 }
 
+crypto_scalar_vector_t crypto_scalar_vector_t::operator*(const crypto_scalar_vector_t &other) &&
+{
+    if (container.size() != other.container.size())
+    {
+        throw std::range_error("vectors must be of the same size");
+    }
+
+    for (size_t i = 0; i < container.size(); ++i)
+    {
+        container[i] *= other.container[i];
+    }
+
+    return crypto_scalar_vector_t(std::move(container));
+}
+
 crypto_point_vector_t crypto_scalar_vector_t::operator*(const crypto_point_vector_t &other) const
 {
     if (container.size() != other.container.size())
@@ -163,6 +240,16 @@ crypto_point_t crypto_scalar_vector_t::inner_product(const crypto_point_vector_t
         return container[0] * other[0];
     }
 
+    /**
+     * Once we have enough terms to amortize the bucket setup costs, the Pippenger
+     * engine wins by a wide margin over pairing the terms off below, so dispatch
+     * into it automatically
+     */
+    if (container.size() >= CRYPTO_MULTIEXP_THRESHOLD)
+    {
+        return Crypto::multiexp(container, other.container);
+    }
+
     /**
      * The method below reduces the number of individual scalar multiplications and additions
      * performed in individual calls by using ge_double_scalarmult_negate_vartime instead
@@ -214,6 +301,28 @@ crypto_scalar_t crypto_scalar_vector_t::inner_product(const crypto_scalar_vector
     return (*this * other).sum();
 }
 
+crypto_scalar_t
+    crypto_scalar_vector_t::weighted_inner_product(const crypto_scalar_vector_t &other, const crypto_scalar_t &y) const
+{
+    if (container.size() != other.container.size())
+    {
+        throw std::range_error("vectors must be of equal size");
+    }
+
+    auto result = Crypto::ZERO;
+
+    auto ypow = y;
+
+    for (size_t i = 0; i < container.size(); ++i)
+    {
+        result += container[i] * ypow * other.container[i];
+
+        ypow *= y;
+    }
+
+    return result;
+}
+
 crypto_scalar_vector_t crypto_scalar_vector_t::invert(bool allow_zero) const
 {
     if (allow_zero)
@@ -297,3 +406,27 @@ crypto_scalar_t crypto_scalar_vector_t::sum() const
 
     return result;
 }
+
+void crypto_scalar_vector_t::from_bytes(const unsigned char *data, size_t length)
+{
+    try
+    {
+        auto cursor = data;
+
+        const auto end = data + length;
+
+        container = WireCodec::read_pod_vector<crypto_scalar_t>(cursor, end);
+    }
+    SMART_CATCH(std::invalid_argument, "Could not deserialize crypto_scalar_vector_t");
+}
+
+std::vector<uint8_t> crypto_scalar_vector_t::to_bytes() const
+{
+    std::vector<uint8_t> result;
+
+    result.reserve(WireCodec::varint_size(container.size()) + (container.size() * 32));
+
+    WireCodec::write_pod_vector(result, container);
+
+    return result;
+}
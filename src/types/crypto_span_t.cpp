@@ -0,0 +1,115 @@
+// Copyright (c) 2020, Brandon Lehmann
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <helpers/multiexp.h>
+#include <types/crypto_span_t.h>
+
+crypto_scalar_vector_t scalar_span_t::operator*(const crypto_scalar_t &other) const
+{
+    std::vector<crypto_scalar_t> result(size());
+
+    for (size_t i = 0; i < size(); ++i)
+    {
+        result[i] = view[i] * other;
+    }
+
+    return crypto_scalar_vector_t(result);
+}
+
+crypto_scalar_t scalar_span_t::inner_product(const scalar_span_t &other) const
+{
+    if (size() != other.size())
+    {
+        throw std::range_error("spans must be of equal size");
+    }
+
+    auto result = Crypto::ZERO;
+
+    for (size_t i = 0; i < size(); ++i)
+    {
+        result += view[i] * other[i];
+    }
+
+    return result;
+}
+
+crypto_point_t scalar_span_t::inner_product(const point_span_t &other) const
+{
+    if (size() != other.size())
+    {
+        throw std::range_error("spans must be of equal size");
+    }
+
+    if (empty())
+    {
+        return Crypto::Z;
+    }
+
+    if (size() == 1)
+    {
+        return view[0] * other[0];
+    }
+
+    // the multiexp engine reads straight out of the views with no copying
+    return Crypto::multiexp(data(), other.data(), size());
+}
+
+scalar_span_t scalar_span_t::slice(size_t start, size_t end) const
+{
+    if (end < start || end > count)
+    {
+        throw std::range_error("requested slice is out of range");
+    }
+
+    return {view + start, end - start};
+}
+
+crypto_point_vector_t point_span_t::dbl_mult(const crypto_scalar_t &a, const point_span_t &B, const crypto_scalar_t &b) const
+{
+    if (size() != B.size())
+    {
+        throw std::range_error("spans must be of equal size");
+    }
+
+    std::vector<crypto_point_t> result(size());
+
+    for (size_t i = 0; i < size(); ++i)
+    {
+        result[i] = a.dbl_mult(view[i], b, B[i]);
+    }
+
+    return crypto_point_vector_t(result);
+}
+
+point_span_t point_span_t::slice(size_t start, size_t end) const
+{
+    if (end < start || end > count)
+    {
+        throw std::range_error("requested slice is out of range");
+    }
+
+    return {view + start, end - start};
+}
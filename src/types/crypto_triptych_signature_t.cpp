@@ -27,6 +27,7 @@
 // Adapted from Python code by Sarang Noether found at
 // https://github.com/SarangNoether/skunkworks/tree/triptych
 
+#include <helpers/wire_codec.h>
 #include <types/crypto_triptych_signature_t.h>
 
 crypto_triptych_signature_t::crypto_triptych_signature_t(std::initializer_list<unsigned char> input)
@@ -182,6 +183,52 @@ void crypto_triptych_signature_t::deserialize(Serialization::deserializer_t &rea
     SMART_CATCH(std::invalid_argument, "Could not deserialize crypto_triptych_signature_t");
 }
 
+void crypto_triptych_signature_t::from_bytes(const unsigned char *data, size_t length)
+{
+    try
+    {
+        auto cursor = data;
+
+        const auto end = data + length;
+
+        A = WireCodec::read_pod<crypto_point_t>(cursor, end);
+
+        B = WireCodec::read_pod<crypto_point_t>(cursor, end);
+
+        C = WireCodec::read_pod<crypto_point_t>(cursor, end);
+
+        D = WireCodec::read_pod<crypto_point_t>(cursor, end);
+
+        X = WireCodec::read_pod_vector<crypto_point_t>(cursor, end);
+
+        Y = WireCodec::read_pod_vector<crypto_point_t>(cursor, end);
+
+        {
+            const auto rows = WireCodec::read_varint(cursor, end);
+
+            f.clear();
+
+            f.reserve(rows);
+
+            for (uint64_t row = 0; row < rows; ++row)
+            {
+                f.push_back(WireCodec::read_pod_vector<crypto_scalar_t>(cursor, end));
+            }
+        }
+
+        zA = WireCodec::read_pod<crypto_scalar_t>(cursor, end);
+
+        zC = WireCodec::read_pod<crypto_scalar_t>(cursor, end);
+
+        z = WireCodec::read_pod<crypto_scalar_t>(cursor, end);
+
+        commitment_image = WireCodec::read_pod<crypto_key_image_t>(cursor, end);
+
+        pseudo_commitment = WireCodec::read_pod<crypto_pedersen_commitment_t>(cursor, end);
+    }
+    SMART_CATCH(std::invalid_argument, "Could not deserialize crypto_triptych_signature_t");
+}
+
 void crypto_triptych_signature_t::fromJSON(const JSONValue &j)
 {
     try
@@ -270,6 +317,53 @@ std::vector<unsigned char> crypto_triptych_signature_t::serialize() const
     return writer.vector();
 }
 
+std::vector<uint8_t> crypto_triptych_signature_t::to_bytes() const
+{
+    size_t f_bytes = WireCodec::varint_size(f.size());
+
+    for (const auto &row : f)
+    {
+        f_bytes += WireCodec::varint_size(row.size()) + (row.size() * 32);
+    }
+
+    std::vector<uint8_t> result;
+
+    result.reserve(
+        (9 * 32) + WireCodec::varint_size(X.size()) + (X.size() * 32) + WireCodec::varint_size(Y.size())
+        + (Y.size() * 32) + f_bytes);
+
+    WireCodec::write_pod(result, A);
+
+    WireCodec::write_pod(result, B);
+
+    WireCodec::write_pod(result, C);
+
+    WireCodec::write_pod(result, D);
+
+    WireCodec::write_pod_vector(result, X);
+
+    WireCodec::write_pod_vector(result, Y);
+
+    WireCodec::write_varint(result, f.size());
+
+    for (const auto &row : f)
+    {
+        WireCodec::write_pod_vector(result, row);
+    }
+
+    WireCodec::write_pod(result, zA);
+
+    WireCodec::write_pod(result, zC);
+
+    WireCodec::write_pod(result, z);
+
+    WireCodec::write_pod(result, commitment_image);
+
+    WireCodec::write_pod(result, pseudo_commitment);
+
+    return result;
+}
+
 size_t crypto_triptych_signature_t::size() const
 {
     return serialize().size();